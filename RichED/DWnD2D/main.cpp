@@ -274,7 +274,7 @@ bool WinDWnD2D::Init(HWND hwnd) noexcept {
             Flag_RichText | Flag_MultiLine,
             //Flag_UsePassword | Flag_MultiLine,
             PASSWORD_CHAR, MAX_LENGTH, 0,
-            VAlign_Baseline, Mode_SpaceOrCJK,
+            VAlign_Baseline, TAlign_Leading, Mode_SpaceOrCJK,
             { DEF_FONT_SIZE, 0, 0, Effect_None } 
         };
         std::memset(&doc, 0xcc, sizeof(doc));
@@ -66,7 +66,7 @@ namespace RichED {
         // descender
         VAlign_Descender,
     };
-    // TextAlign [unsupported yet]
+    // TextAlign
     enum TextAlign : uint16_t {
         // leading/begin
         TAlign_Leading = 0,
@@ -81,9 +81,9 @@ namespace RichED {
     enum WrapMode : uint16_t {
         // no wrap
         Mode_NoWrap = 0,
-        // space only
+        // space and punctuation only [UAX #14, cjk kept as word]
         Mode_SpaceOnly,
-        // wrap cjk anwhere, other up to space
+        // wrap cjk anwhere, other up to space [UAX #14]
         Mode_SpaceOrCJK,
         // anwhere
         Mode_Anywhere
@@ -102,6 +102,8 @@ namespace RichED {
         Flag_MultiLine = 1 << 3,
         // password mode
         Flag_UsePassword = 1 << 4,
+        // platform is thread-safe[see IEDTextPlatform], LayoutAll is serial without it
+        Flag_ThreadSafePlatform = 1 << 5,
     };
     // OP
     RED_FLAG_OP(DocFlag, uint32_t);
@@ -234,6 +236,7 @@ namespace RichED {
         Box             bounding;
         // layout offset
         Point           offset;
+        // ---- layout-hot part, keep at the end ----
         // layout width
         unit_t          width;
         // offset for visual-line 
@@ -243,6 +246,17 @@ namespace RichED {
         // deascender-height
         unit_t          dr_height;
     };
+    // grapheme clusters of cell [UAX #29], computed on demand
+    struct CellClusters {
+        // bit i set if cluster breaks before unit i
+        uint32_t        bits[2];
+        // breaker state before first unit
+        uint8_t         enter;
+        // breaker state after last unit
+        uint8_t         leave;
+        // leave depends on enter
+        bool            transparent;
+    };
     // cell metainfo
     struct CellMeta {
         // type
@@ -253,6 +267,8 @@ namespace RichED {
         //bool            bol : 1;
         // dirty
         bool            dirty : 1;
+        // clusters computed
+        bool            segmented : 1;
         // reduce
         //bool            reduce : 1;
     };
@@ -295,7 +311,7 @@ namespace RichED {
         // valign
         VerticalAlign       valign;
         // text align
-        //TextAlign           talign;
+        TextAlign           talign;
         // wrap mode
         WrapMode            wrap_mode;
         // init-riched
@@ -327,7 +343,7 @@ namespace RichED {
         // vertical align
         VerticalAlign   valign;
         // text align
-        //TextAlign       talign;
+        TextAlign       talign;
         // wrap mode
         WrapMode        wrap_mode;
     };
@@ -356,12 +372,12 @@ namespace RichED {
     };
     // singe op for rich
     struct RichSingeOp {
-        // under riched
-        RichData        riched;
         // begin point
         DocPoint        begin;
         // end point
         DocPoint        end;
+        // under style id
+        uint16_t        style;
     };
 }
 
@@ -29,9 +29,36 @@
 
 #endif
 
+// prefetch hint for layout walk
+#ifndef RED_PREFETCH
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#define RED_PREFETCH(p) _mm_prefetch(reinterpret_cast<const char*>(p), _MM_HINT_T0)
+#elif defined(__GNUC__)
+#define RED_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define RED_PREFETCH(p) (void)(p)
+#endif
+#endif
+
+// simd text classification: sse2 as baseline on x86, avx2 dispatched at runtime
+#ifndef RED_NO_SIMD
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define RED_SIMD_SSE2
+#if defined(_MSC_VER)
+#define RED_SIMD_AVX2
+#define RED_TARGET_AVX2
+#elif defined(__GNUC__)
+#define RED_SIMD_AVX2
+#define RED_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+#endif
+
 //#define RED_UNDOREDO
 
 #include <cstdint>
+#include <cstddef>
 
 //#include <new>
 
@@ -43,14 +70,54 @@ namespace RichED {
         TEXT_CELL_STR_MAXLEN = 63,
         // password input buffer [via IME or API]
         PASSWORD_INPUT_BUFFER = 32,
+        // min logic line count skipped by random-access layout
+        LAYOUT_SKIP_LINE = 1024,
 #else
         // fixed length, 1 for surrogate
         TEXT_CELL_STR_MAXLEN = 9,
         // password input buffer [via IME or API]
         PASSWORD_INPUT_BUFFER = 2,
+        // min logic line count skipped by random-access layout
+        LAYOUT_SKIP_LINE = 4,
 #endif
         // merge min len
         TEXT_MERGE_LEN = 4,
+        // min capacity of cell class, 1 for surrogate
+        TEXT_CELL_STR_MINCAP = 7,
+        // count of cell class [8, 16, 32, 64]
+        TEXT_CELL_CLASS_COUNT = 4,
+        // prefetch distance of logic line for layout walk
+        LAYOUT_PREFETCH_LINE = 8,
+        // cell count walked before using cell index
+        CELL_INDEX_WALK = 8,
+        // max viewport width count in wrap cache per logic line
+        WRAP_CACHE_WIDTH = 4,
+        // max break count in wrap cache per logic line
+        WRAP_CACHE_BREAK = 64,
+        // word count of break opportunities kept on stack for short logic line
+        WRAP_BREAK_LOCAL = 8,
+        // prior logic line count of height estimation
+        LAYOUT_ESTIMATE_LINE = 64,
+        // init logic line count laid out per layout step, adapted to time
+        LAYOUT_ASYNC_LINE = 64,
+        // target time[us] of background layout step, bounds EndLayoutAsync wait
+        LAYOUT_ASYNC_US = 1000,
+        // min logic line count per parallel layout chunk
+        LAYOUT_PARALLEL_LINE = 1024,
+        // max chunk count of parallel layout
+        LAYOUT_PARALLEL_CHUNK = 128,
+        // max thread count of parallel layout
+        LAYOUT_PARALLEL_THREAD = 32,
+        // max char count of word matched in word dictionary
+        WORD_DICT_MAXLEN = 32,
+        // init capacity of style table
+        TEXT_STYLE_INIT_COUNT = 16,
+        // style count of one page in style table
+        TEXT_STYLE_PAGE_LEN = 16,
+        // compact style table before gui rich op if style count reached
+        TEXT_STYLE_COMPACT_COUNT = 0xf000,
+        // invalid style id, also max count of style
+        TEXT_STYLE_INVALID = 0xffff,
     };
     // small object
     struct /*alignas()*/ CEDSmallObject {
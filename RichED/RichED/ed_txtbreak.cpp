@@ -0,0 +1,924 @@
+﻿#include "ed_config.h"
+#include "ed_txtbreak.h"
+#include "ed_txtcell.h"
+#include <algorithm>
+#include <cassert>
+#ifdef RED_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef RED_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace RichED { namespace impl {
+    // action of pair table
+    enum : uint8_t {
+        // break allowed
+        lb_direct = 0,
+        // break allowed only if spaces between
+        lb_indirect,
+        // break not allowed even if spaces between
+        lb_prohibited,
+    };
+    // is one of
+    constexpr bool lb_in(uint8_t c, uint8_t a, uint8_t b) noexcept { return c == a || c == b; }
+    // action of pair [before, after], rules LB7-LB31 applied in order
+    constexpr uint8_t lb_pair(uint8_t a, uint8_t b) noexcept {
+        const bool a_alpha = lb_in(a, LB_AL, LB_HL);
+        const bool b_alpha = lb_in(b, LB_AL, LB_HL);
+        const bool a_hangul = a == LB_JL || a == LB_JV || a == LB_JT || a == LB_H2 || a == LB_H3;
+        const bool b_hangul = b == LB_JL || b == LB_JV || b == LB_JT || b == LB_H2 || b == LB_H3;
+        // LB7 × ZW, LB8 ZW SP* ÷
+        if (b == LB_ZW) return lb_prohibited;
+        if (a == LB_ZW) return lb_direct;
+        // LB11 × WJ, WJ ×
+        if (b == LB_WJ) return lb_prohibited;
+        if (a == LB_WJ) return lb_indirect;
+        // LB12 GL ×, LB12a [^SP BA HY] × GL
+        if (a == LB_GL) return lb_indirect;
+        if (b == LB_GL) return lb_in(a, LB_BA, LB_HY) ? lb_direct : lb_indirect;
+        // LB13 × CL, CP, EX, IS, SY
+        if (lb_in(b, LB_CL, LB_CP) || lb_in(b, LB_EX, LB_IS) || b == LB_SY) return lb_prohibited;
+        // LB14 OP SP* ×
+        if (a == LB_OP) return lb_prohibited;
+        // LB15 QU SP* × OP, LB16 (CL | CP) SP* × NS, LB17 B2 SP* × B2
+        if (a == LB_QU && b == LB_OP) return lb_prohibited;
+        if (lb_in(a, LB_CL, LB_CP) && b == LB_NS) return lb_prohibited;
+        if (a == LB_B2 && b == LB_B2) return lb_prohibited;
+        // LB19 × QU, QU ×
+        if (a == LB_QU || b == LB_QU) return lb_indirect;
+        // LB20 ÷ CB, CB ÷
+        if (a == LB_CB || b == LB_CB) return lb_direct;
+        // LB21 × BA, × HY, × NS, BB ×, LB21b SY × HL, LB22 × IN
+        if (lb_in(b, LB_BA, LB_HY) || b == LB_NS || a == LB_BB) return lb_indirect;
+        if (a == LB_SY && b == LB_HL) return lb_indirect;
+        if (b == LB_IN) return lb_indirect;
+        // LB23 (AL | HL) × NU, NU × (AL | HL)
+        if ((a_alpha && b == LB_NU) || (a == LB_NU && b_alpha)) return lb_indirect;
+        // LB23a PR × (ID | EB | EM), (ID | EB | EM) × PO
+        if (a == LB_PR && (b == LB_ID || lb_in(b, LB_EB, LB_EM))) return lb_indirect;
+        if ((a == LB_ID || lb_in(a, LB_EB, LB_EM)) && b == LB_PO) return lb_indirect;
+        // LB24 (PR | PO) × (AL | HL), (AL | HL) × (PR | PO)
+        if ((lb_in(a, LB_PR, LB_PO) && b_alpha) || (a_alpha && lb_in(b, LB_PR, LB_PO))) return lb_indirect;
+        // LB25 (CL | CP | NU) × (PO | PR), (PO | PR) × (OP | NU), (HY | IS | NU | SY) × NU
+        if ((lb_in(a, LB_CL, LB_CP) || a == LB_NU) && lb_in(b, LB_PO, LB_PR)) return lb_indirect;
+        if (lb_in(a, LB_PO, LB_PR) && lb_in(b, LB_OP, LB_NU)) return lb_indirect;
+        if ((lb_in(a, LB_HY, LB_IS) || lb_in(a, LB_NU, LB_SY)) && b == LB_NU) return lb_indirect;
+        // LB26 JL × (JL | JV | H2 | H3), (JV | H2) × (JV | JT), (JT | H3) × JT
+        if (a == LB_JL && b_hangul && b != LB_JT) return lb_indirect;
+        if (lb_in(a, LB_JV, LB_H2) && lb_in(b, LB_JV, LB_JT)) return lb_indirect;
+        if (lb_in(a, LB_JT, LB_H3) && b == LB_JT) return lb_indirect;
+        // LB27 (JL | JV | JT | H2 | H3) × PO, PR × (JL | JV | JT | H2 | H3)
+        if ((a_hangul && b == LB_PO) || (a == LB_PR && b_hangul)) return lb_indirect;
+        // LB28 (AL | HL) × (AL | HL), LB29 IS × (AL | HL)
+        if ((a_alpha || a == LB_IS) && b_alpha) return lb_indirect;
+        // LB30 (AL | HL | NU) × OP, CP × (AL | HL | NU)
+        if ((a_alpha || a == LB_NU) && b == LB_OP) return lb_indirect;
+        if (a == LB_CP && (b_alpha || b == LB_NU)) return lb_indirect;
+        // LB30a RI × RI [paired by breaker], LB30b EB × EM
+        if (a == LB_RI && b == LB_RI) return lb_indirect;
+        if (a == LB_EB && b == LB_EM) return lb_indirect;
+        // LB31 ÷
+        return lb_direct;
+    }
+    // pair table generated at compile time
+    struct lb_table {
+        uint8_t data[LB_CB + 1][LB_CB + 1];
+        constexpr lb_table() noexcept : data{} {
+            for (uint8_t a = 0; a <= LB_CB; ++a)
+                for (uint8_t b = 0; b <= LB_CB; ++b)
+                    data[a][b] = lb_pair(a, b);
+        }
+    };
+    static constexpr lb_table lb_pairs{};
+    // action of grapheme pair
+    enum : uint8_t {
+        // break
+        gb_break = 0,
+        // no break
+        gb_keep,
+        // no break if emoji sequence before [GB11]
+        gb_emoji,
+        // no break if odd regional indicators before [GB12, GB13]
+        gb_ri,
+    };
+    // bits of grapheme breaker state
+    enum : uint8_t {
+        gb_state_odd = 1 << 4,
+        gb_state_pict = 1 << 5,
+        gb_state_zwj = 2 << 5,
+        gb_state_seq = 3 << 5,
+    };
+    // is control, CR or LF
+    constexpr bool gb_control(uint8_t c) noexcept { return c == GB_Control || c == GB_CR || c == GB_LF; }
+    // action of pair [before, after], rules GB3-GB999 applied in order
+    constexpr uint8_t gb_pair(uint8_t a, uint8_t b) noexcept {
+        // GB1 sot ÷
+        if (a == GB_COUNT) return gb_break;
+        // GB3 CR × LF, GB4 (Control | CR | LF) ÷, GB5 ÷ (Control | CR | LF)
+        if (a == GB_CR && b == GB_LF) return gb_keep;
+        if (gb_control(a) || gb_control(b)) return gb_break;
+        // GB6 L × (L | V | LV | LVT)
+        if (a == GB_L && (b == GB_L || b == GB_V || b == GB_LV || b == GB_LVT)) return gb_keep;
+        // GB7 (LV | V) × (V | T)
+        if ((a == GB_LV || a == GB_V) && (b == GB_V || b == GB_T)) return gb_keep;
+        // GB8 (LVT | T) × T
+        if ((a == GB_LVT || a == GB_T) && b == GB_T) return gb_keep;
+        // GB9 × (Extend | ZWJ), GB9a × SpacingMark, GB9b Prepend ×
+        if (b == GB_Extend || b == GB_ZWJ || b == GB_SpacingMark) return gb_keep;
+        if (a == GB_Prepend) return gb_keep;
+        // GB11 ExtPict Extend* ZWJ × ExtPict
+        if (a == GB_ZWJ) return gb_emoji;
+        // GB12, GB13 RI × RI
+        if (a == GB_RI && b == GB_RI) return gb_ri;
+        // GB999 ÷
+        return gb_break;
+    }
+    // grapheme pair table generated at compile time
+    struct gb_table {
+        uint8_t data[GB_COUNT + 1][GB_COUNT];
+        constexpr gb_table() noexcept : data{} {
+            for (uint8_t a = 0; a <= GB_COUNT; ++a)
+                for (uint8_t b = 0; b < GB_COUNT; ++b)
+                    data[a][b] = gb_pair(a, b);
+        }
+    };
+    static constexpr gb_table gb_pairs{};
+    // is Newline, CR or LF
+    constexpr bool wb_newline(uint8_t c) noexcept { return c == WB_Newline || c == WB_CR || c == WB_LF; }
+    // is AHLetter
+    constexpr bool wb_letter(uint8_t c) noexcept { return c == WB_ALetter || c == WB_HebrewLetter; }
+    // is MidNumLetQ
+    constexpr bool wb_midq(uint8_t c) noexcept { return c == WB_MidNumLet || c == WB_SingleQuote; }
+    // is AHLetter, Numeric or Katakana
+    constexpr bool wb_word(uint8_t c) noexcept { return wb_letter(c) || c == WB_Numeric || c == WB_Katakana; }
+    // action of pair [last, next], rules WB3-WB999 applied in order
+    constexpr uint8_t wb_pair(uint8_t a, uint8_t b) noexcept {
+        // WB3 CR × LF, WB3a (Newline | CR | LF) ÷, WB3b ÷ (Newline | CR | LF)
+        if (a == WB_CR && b == WB_LF) return WBA_Keep;
+        if (wb_newline(a) || wb_newline(b)) return WBA_Break;
+        // WB4 X (Extend | Format | ZWJ)* → X
+        if (b == WB_Extend || b == WB_Format || b == WB_ZWJ) return WBA_Keep;
+        // WB5 AHLetter × AHLetter
+        if (wb_letter(a) && wb_letter(b)) return WBA_Keep;
+        // WB7a Hebrew_Letter × Single_Quote, 优先于WB6的条件
+        if (a == WB_HebrewLetter && b == WB_SingleQuote) return WBA_Keep;
+        // WB6 AHLetter × (MidLetter | MidNumLetQ) AHLetter
+        if (wb_letter(a) && (b == WB_MidLetter || wb_midq(b))) return WBA_AheadLetter;
+        // WB7 AHLetter (MidLetter | MidNumLetQ) × AHLetter
+        if ((a == WB_MidLetter || wb_midq(a)) && wb_letter(b)) return WBA_BehindLetter;
+        // WB7b Hebrew_Letter × Double_Quote Hebrew_Letter
+        if (a == WB_HebrewLetter && b == WB_DoubleQuote) return WBA_AheadHebrew;
+        // WB7c Hebrew_Letter Double_Quote × Hebrew_Letter
+        if (a == WB_DoubleQuote && b == WB_HebrewLetter) return WBA_BehindHebrew;
+        // WB8 Numeric × Numeric, WB9 AHLetter × Numeric, WB10 Numeric × AHLetter
+        if ((wb_letter(a) || a == WB_Numeric) && (wb_letter(b) || b == WB_Numeric)) return WBA_Keep;
+        // WB11 Numeric (MidNum | MidNumLetQ) × Numeric
+        if ((a == WB_MidNum || wb_midq(a)) && b == WB_Numeric) return WBA_BehindNumeric;
+        // WB12 Numeric × (MidNum | MidNumLetQ) Numeric
+        if (a == WB_Numeric && (b == WB_MidNum || wb_midq(b))) return WBA_AheadNumeric;
+        // WB13 Katakana × Katakana
+        if (a == WB_Katakana && b == WB_Katakana) return WBA_Keep;
+        // WB13a (AHLetter | Numeric | Katakana | ExtendNumLet) × ExtendNumLet
+        if ((wb_word(a) || a == WB_ExtendNumLet) && b == WB_ExtendNumLet) return WBA_Keep;
+        // WB13b ExtendNumLet × (AHLetter | Numeric | Katakana)
+        if (a == WB_ExtendNumLet && wb_word(b)) return WBA_Keep;
+        // WB15, WB16 RI × RI
+        if (a == WB_RI && b == WB_RI) return WBA_RI;
+        // WB999 ÷
+        return WBA_Break;
+    }
+    // word pair table generated at compile time
+    struct wb_table {
+        uint8_t data[WB_COUNT][WB_COUNT];
+        constexpr wb_table() noexcept : data{} {
+            for (uint8_t a = 0; a < WB_COUNT; ++a)
+                for (uint8_t b = 0; b < WB_COUNT; ++b)
+                    data[a][b] = wb_pair(a, b);
+        }
+    };
+    static constexpr wb_table wb_pairs{};
+    // index of lowest set bit, x != 0
+    inline uint32_t bit_low(uint32_t x) noexcept {
+#ifdef _MSC_VER
+        unsigned long i; _BitScanForward(&i, x); return i;
+#else
+        return uint32_t(__builtin_ctz(x));
+#endif
+    }
+    // index of highest set bit, x != 0
+    inline uint32_t bit_high(uint32_t x) noexcept {
+#ifdef _MSC_VER
+        unsigned long i; _BitScanReverse(&i, x); return i;
+#else
+        return uint32_t(31 - __builtin_clz(x));
+#endif
+    }
+    // count of low set bits
+    inline uint32_t bit_run(uint32_t x) noexcept { return ~x ? bit_low(~x) : 32; }
+    // set bits [pos, pos + count)
+    inline void bit_set(uint32_t* bits, uint32_t pos, uint32_t count) noexcept {
+        while (count) {
+            const auto shift = pos & 31;
+            const auto take = std::min(32 - shift, count);
+            const auto mask = take == 32 ? ~uint32_t(0) : ((uint32_t(1) << take) - 1);
+            bits[pos >> 5] |= mask << shift;
+            pos += take;
+            count -= take;
+        }
+    }
+    // classify utf-16 units one by one
+    static void classify_scalar(const char16_t* str, uint32_t len, CharMasks& masks) noexcept {
+        masks = {};
+        for (uint32_t i = 0; i != len; ++i) {
+            const uint16_t ch = str[i];
+            const uint32_t bit = uint32_t(1) << i;
+            if (ch == ' ') masks.space |= bit;
+            if (uint16_t((ch | 0x20) - 'a') < 26 || uint16_t(ch - '0') < 10) masks.alnum |= bit;
+            if (uint16_t(ch - 0x4E00) < 0x5200 || uint16_t(ch - 0x3400) < 0x19C0 || uint16_t(ch - 0xF900) < 0x200)
+                masks.cjk |= bit;
+            if ((ch & 0xF800) == 0xD800) masks.surrogate |= bit;
+        }
+    }
+    // classify tail units after simd blocks
+    static void classify_tail(const char16_t* str, uint32_t i, uint32_t len, CharMasks& masks) noexcept {
+        if (i == len) return;
+        CharMasks tail;
+        classify_scalar(str + i, len - i, tail);
+        masks.space |= tail.space << i;
+        masks.alnum |= tail.alnum << i;
+        masks.cjk |= tail.cjk << i;
+        masks.surrogate |= tail.surrogate << i;
+    }
+#ifdef RED_SIMD_SSE2
+    // bit i set if 16-bit lane i of cmp set
+    inline uint32_t sse2_mask(__m128i cmp) noexcept {
+        return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(cmp, _mm_setzero_si128())));
+    }
+    // unsigned 16-bit x < n via saturated subtraction
+    inline __m128i sse2_less(__m128i x, uint16_t n) noexcept {
+        const auto diff = _mm_subs_epu16(x, _mm_set1_epi16(short(n - 1)));
+        return _mm_cmpeq_epi16(diff, _mm_setzero_si128());
+    }
+    // classify 8 units per step
+    static void classify_sse2(const char16_t* str, uint32_t len, CharMasks& masks) noexcept {
+        masks = {};
+        uint32_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+            const auto lower = _mm_or_si128(v, _mm_set1_epi16(0x20));
+            const auto alpha = sse2_less(_mm_sub_epi16(lower, _mm_set1_epi16('a')), 26);
+            const auto digit = sse2_less(_mm_sub_epi16(v, _mm_set1_epi16('0')), 10);
+            const auto cjk = _mm_or_si128(_mm_or_si128(
+                sse2_less(_mm_sub_epi16(v, _mm_set1_epi16(0x4E00)), 0x5200),
+                sse2_less(_mm_sub_epi16(v, _mm_set1_epi16(0x3400)), 0x19C0)),
+                sse2_less(_mm_sub_epi16(v, _mm_set1_epi16(short(0xF900))), 0x200));
+            const auto surrogate = _mm_cmpeq_epi16(
+                _mm_and_si128(v, _mm_set1_epi16(short(0xF800))), _mm_set1_epi16(short(0xD800)));
+            masks.space |= sse2_mask(_mm_cmpeq_epi16(v, _mm_set1_epi16(' '))) << i;
+            masks.alnum |= sse2_mask(_mm_or_si128(alpha, digit)) << i;
+            masks.cjk |= sse2_mask(cjk) << i;
+            masks.surrogate |= sse2_mask(surrogate) << i;
+        }
+        classify_tail(str, i, len, masks);
+    }
+#endif
+#ifdef RED_SIMD_AVX2
+    // bit i set if 16-bit lane i of cmp set
+    RED_TARGET_AVX2 inline uint32_t avx2_mask(__m256i cmp) noexcept {
+        // 按128位分别打包: [0-7, 0, 8-15, 0]
+        const auto m = uint32_t(_mm256_movemask_epi8(_mm256_packs_epi16(cmp, _mm256_setzero_si256())));
+        return (m & 0xff) | ((m >> 8) & 0xff00);
+    }
+    // unsigned 16-bit x < n via saturated subtraction
+    RED_TARGET_AVX2 inline __m256i avx2_less(__m256i x, uint16_t n) noexcept {
+        const auto diff = _mm256_subs_epu16(x, _mm256_set1_epi16(short(n - 1)));
+        return _mm256_cmpeq_epi16(diff, _mm256_setzero_si256());
+    }
+    // classify 16 units per step
+    RED_TARGET_AVX2 static void classify_avx2(const char16_t* str, uint32_t len, CharMasks& masks) noexcept {
+        masks = {};
+        uint32_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+            const auto lower = _mm256_or_si256(v, _mm256_set1_epi16(0x20));
+            const auto alpha = avx2_less(_mm256_sub_epi16(lower, _mm256_set1_epi16('a')), 26);
+            const auto digit = avx2_less(_mm256_sub_epi16(v, _mm256_set1_epi16('0')), 10);
+            const auto cjk = _mm256_or_si256(_mm256_or_si256(
+                avx2_less(_mm256_sub_epi16(v, _mm256_set1_epi16(0x4E00)), 0x5200),
+                avx2_less(_mm256_sub_epi16(v, _mm256_set1_epi16(0x3400)), 0x19C0)),
+                avx2_less(_mm256_sub_epi16(v, _mm256_set1_epi16(short(0xF900))), 0x200));
+            const auto surrogate = _mm256_cmpeq_epi16(
+                _mm256_and_si256(v, _mm256_set1_epi16(short(0xF800))), _mm256_set1_epi16(short(0xD800)));
+            masks.space |= avx2_mask(_mm256_cmpeq_epi16(v, _mm256_set1_epi16(' '))) << i;
+            masks.alnum |= avx2_mask(_mm256_or_si256(alpha, digit)) << i;
+            masks.cjk |= avx2_mask(cjk) << i;
+            masks.surrogate |= avx2_mask(surrogate) << i;
+        }
+        classify_tail(str, i, len, masks);
+    }
+    // cpu and os support avx2
+    static bool has_avx2() noexcept {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+        __cpuid(info, 1);
+        // OSXSAVE + AVX, 系统保存YMM状态
+        if ((info[2] & (3 << 27)) != (3 << 27)) return false;
+        if ((_xgetbv(0) & 6) != 6) return false;
+        __cpuidex(info, 7, 0);
+        return !!(info[1] & (1 << 5));
+#else
+        return !!__builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+    // classify function
+    using classify_fn = void(*)(const char16_t*, uint32_t, CharMasks&);
+    // choose classify function at runtime
+    static classify_fn choose_classify() noexcept {
+#ifdef RED_SIMD_AVX2
+        if (has_avx2()) return classify_avx2;
+#endif
+#ifdef RED_SIMD_SSE2
+        return classify_sse2;
+#else
+        return classify_scalar;
+#endif
+    }
+    // classify function chosen once
+    static const classify_fn classify = choose_classify();
+}}
+
+
+/// <summary>
+/// Classifies utf-16 units.
+/// </summary>
+/// <param name="str">The string.</param>
+/// <param name="len">The length, 32 at most.</param>
+/// <param name="masks">The masks.</param>
+/// <returns></returns>
+void RichED::ClassifyChars(const char16_t* str, uint32_t len, CharMasks& masks) noexcept {
+    assert(len <= 32);
+    impl::classify(str, len, masks);
+}
+
+/// <summary>
+/// Finds first set bit in [begin, end).
+/// </summary>
+/// <param name="bits">The bits.</param>
+/// <param name="begin">The begin.</param>
+/// <param name="end">The end.</param>
+/// <returns>end if none</returns>
+auto RichED::FindBitForward(const uint32_t* bits, uint32_t begin, uint32_t end) noexcept -> uint32_t {
+    if (begin >= end) return end;
+    auto index = begin >> 5;
+    const auto last = (end - 1) >> 5;
+    auto word = bits[index] & (~uint32_t(0) << (begin & 31));
+    while (!word) {
+        if (index == last) return end;
+        word = bits[++index];
+    }
+    return std::min((index << 5) + impl::bit_low(word), end);
+}
+
+/// <summary>
+/// Finds last set bit in [begin, end).
+/// </summary>
+/// <param name="bits">The bits.</param>
+/// <param name="begin">The begin.</param>
+/// <param name="end">The end.</param>
+/// <returns>end if none</returns>
+auto RichED::FindBitBackward(const uint32_t* bits, uint32_t begin, uint32_t end) noexcept -> uint32_t {
+    if (begin >= end) return end;
+    auto index = (end - 1) >> 5;
+    const auto first = begin >> 5;
+    auto word = bits[index] & (~uint32_t(0) >> (31 - ((end - 1) & 31)));
+    while (!word) {
+        if (index == first) return end;
+        word = bits[--index];
+    }
+    const auto pos = (index << 5) + impl::bit_high(word);
+    return pos >= begin ? pos : end;
+}
+
+
+/// <summary>
+/// Gets the line break class of char.
+/// </summary>
+/// <param name="ch">The char.</param>
+/// <returns></returns>
+auto RichED::GetLineBreakClass(char32_t ch) noexcept -> LineBreakClass {
+    return GetCharProperty(ch).LineBreak();
+}
+
+/// <summary>
+/// Feeds the char class.
+/// </summary>
+/// <param name="cls">The class.</param>
+/// <returns>true if break allowed before it</returns>
+bool RichED::CEDLineBreaker::Feed(LineBreakClass cls) noexcept {
+    // 避头尾之外不区分CJK
+    if (m_bKeepAll && (cls == LB_ID || (cls >= LB_H2 && cls <= LB_JT))) cls = LB_AL;
+    const auto last = m_clsLast;
+    // LB2 行首不断行, 行首空格视为WJ
+    if (last == LB_COUNT) {
+        if (cls == LB_SP) cls = LB_WJ;
+        else if (cls == LB_CM || cls == LB_ZWJ) cls = LB_AL;
+        else if (cls == LB_CR || cls == LB_LF || cls == LB_NL) cls = LB_BK;
+        m_clsLast = cls;
+        m_cRI = cls == LB_RI;
+        m_bZWJ = false;
+        return false;
+    }
+    // LB4, LB5 强制断行后
+    if (last == LB_BK) {
+        m_clsLast = LB_COUNT;
+        this->Feed(cls);
+        return true;
+    }
+    // LB6 × (BK | CR | LF | NL), LB7 × SP
+    if (cls == LB_BK || cls == LB_CR || cls == LB_LF || cls == LB_NL) {
+        m_clsLast = LB_BK;
+        m_bSpace = m_bZWJ = false;
+        return false;
+    }
+    if (cls == LB_SP) {
+        m_bSpace = true;
+        m_bZWJ = false;
+        return false;
+    }
+    // LB9 X (CM | ZWJ)* 视为 X, LB10 空格后视为AL
+    if (cls == LB_CM || cls == LB_ZWJ) {
+        if (!m_bSpace && last != LB_ZW) {
+            m_bZWJ = cls == LB_ZWJ;
+            return false;
+        }
+        cls = LB_AL;
+    }
+    const auto action = impl::lb_pairs.data[last][cls];
+    bool rv = action == impl::lb_direct || (action == impl::lb_indirect && m_bSpace);
+    // LB8a ZWJ × (ID | EB | EM)
+    if (m_bZWJ && !m_bSpace && (cls == LB_ID || cls == LB_EB || cls == LB_EM)) rv = false;
+    // LB30a 区域指示符两两成对
+    if (cls == LB_RI) {
+        const bool pair = last == LB_RI && !m_bSpace && (m_cRI & 1);
+        if (last == LB_RI && !m_bSpace) rv = !pair;
+        m_cRI = pair ? 0 : 1;
+    }
+    m_clsLast = cls;
+    m_bSpace = m_bZWJ = false;
+    return rv;
+}
+
+/// <summary>
+/// Feeds one char.
+/// </summary>
+/// <param name="str">The string.</param>
+/// <param name="i">The index of char.</param>
+/// <param name="len">The length of string.</param>
+/// <param name="bits">The bits of break opportunities.</param>
+/// <param name="offset">The offset of string in bits.</param>
+/// <returns>unit count of char</returns>
+auto RichED::CEDLineBreaker::feed_char(const char16_t* str, uint32_t i, uint32_t len,
+    uint32_t* bits, uint32_t offset) noexcept -> uint32_t {
+    char32_t ch = str[i];
+    const auto pos = offset + i;
+    uint32_t count = 1;
+    // 代理对作为一个字符, 不在中间断行
+    if ((ch & 0xFC00) == 0xD800 && i + 1 != len && (str[i + 1] & 0xFC00) == 0xDC00) {
+        ch = ((ch - 0xD800) << 10 | (str[i + 1] - 0xDC00)) + 0x10000;
+        count = 2;
+    }
+    const auto cls = GetCharProperty(ch).LineBreak();
+    bool brk;
+    // 同类字符相连: 状态不变, 直接查表
+    if (cls == m_clsLast && cls <= LB_CB && cls != LB_RI && !(m_bSpace | m_bZWJ))
+        brk = impl::lb_pairs.data[cls][cls] == impl::lb_direct;
+    else brk = this->Feed(cls);
+    if (brk) bits[pos >> 5] |= uint32_t(1) << (pos & 31);
+    return count;
+}
+
+/// <summary>
+/// Feeds the utf-16 string.
+/// </summary>
+/// <param name="str">The string.</param>
+/// <param name="len">The length.</param>
+/// <param name="bits">The bits of break opportunities.</param>
+/// <param name="offset">The offset of string in bits.</param>
+/// <returns></returns>
+void RichED::CEDLineBreaker::Feed(const char16_t* str, uint32_t len,
+    uint32_t* bits, uint32_t offset) noexcept {
+#ifndef RED_SIMD_SSE2
+    // 无SIMD时逐个分类得不偿失
+    for (uint32_t i = 0; i < len; )
+        i += this->feed_char(str, i, len, bits, offset);
+#else
+    CharMasks masks;
+    for (uint32_t i = 0; i < len; ) {
+        // 每次分类32个单元, 连续的同类字符整段跳过
+        const auto window = str + i;
+        const auto rest = len - i;
+        const auto count = std::min(rest, uint32_t(32));
+        impl::classify(window, count, masks);
+        uint32_t j = 0;
+        while (j < count) {
+            const bool plain = !(m_bSpace | m_bZWJ);
+            // 字母数字之间不断行, 避头尾模式下表意文字视为字母
+            if (plain && (m_clsLast == LB_AL || m_clsLast == LB_NU)) {
+                const auto word = masks.alnum | (m_bKeepAll ? masks.cjk : 0);
+                if (const auto run = impl::bit_run(word >> j)) {
+                    j += run;
+                    const auto last = window[j - 1];
+                    m_clsLast = last <= '9' ? LB_NU : LB_AL;
+                    continue;
+                }
+            }
+            // 表意文字之间均可断行
+            else if (plain && m_clsLast == LB_ID && !m_bKeepAll) {
+                if (const auto run = impl::bit_run(masks.cjk >> j)) {
+                    impl::bit_set(bits, offset + i + j, run);
+                    j += run;
+                    continue;
+                }
+            }
+            j += this->feed_char(window, j, rest, bits, offset + i);
+        }
+        i += j;
+    }
+#endif
+}
+
+
+/// <summary>
+/// Feeds the char property.
+/// </summary>
+/// <param name="prop">The property.</param>
+/// <returns>true if cluster breaks before it</returns>
+bool RichED::CEDGraphemeBreaker::Feed(CharProperty prop) noexcept {
+    const auto cls = prop.GraphemeBreak();
+    const auto last = m_state & 0xf;
+    const auto seq = m_state & impl::gb_state_seq;
+    bool brk;
+    switch (impl::gb_pairs.data[last][cls])
+    {
+    case impl::gb_keep:  brk = false; break;
+    case impl::gb_emoji: brk = !(seq == impl::gb_state_zwj && prop.Pictographic()); break;
+    case impl::gb_ri:    brk = !(m_state & impl::gb_state_odd); break;
+    default:             brk = true; break;
+    }
+    uint8_t state = cls;
+    // 区域指示符两两成对
+    if (cls == GB_RI && !(last == GB_RI && (m_state & impl::gb_state_odd)))
+        state |= impl::gb_state_odd;
+    // 表情序列: ExtPict Extend* ZWJ
+    if (prop.Pictographic()) state |= impl::gb_state_pict;
+    else if (seq == impl::gb_state_pict) {
+        if (cls == GB_Extend) state |= impl::gb_state_pict;
+        else if (cls == GB_ZWJ) state |= impl::gb_state_zwj;
+    }
+    m_state = state;
+    return brk;
+}
+
+/// <summary>
+/// Feeds the utf-16 string.
+/// </summary>
+/// <param name="str">The string.</param>
+/// <param name="len">The length.</param>
+/// <param name="bits">The bits of boundaries.</param>
+/// <param name="offset">The offset of string in bits.</param>
+/// <returns>true if state after still depends on state before</returns>
+bool RichED::CEDGraphemeBreaker::Feed(const char16_t* str, uint32_t len,
+    uint32_t* bits, uint32_t offset) noexcept {
+    // 全是RI或者全是Extend/ZWJ时, 状态会延续下去
+    bool all_ri = true, all_extend = true;
+    for (uint32_t i = 0; i < len; ) {
+        char32_t ch = str[i];
+        const auto pos = offset + i;
+        ++i;
+        // 代理对作为一个字符, 不在中间断开
+        if ((ch & 0xFC00) == 0xD800 && i != len && (str[i] & 0xFC00) == 0xDC00) {
+            ch = ((ch - 0xD800) << 10 | (str[i] - 0xDC00)) + 0x10000;
+            ++i;
+        }
+        const auto prop = GetCharProperty(ch);
+        if (this->Feed(prop)) bits[pos >> 5] |= uint32_t(1) << (pos & 31);
+        const auto cls = prop.GraphemeBreak();
+        all_ri &= cls == GB_RI;
+        all_extend &= cls == GB_Extend || cls == GB_ZWJ;
+    }
+    return all_ri || all_extend;
+}
+
+
+/// <summary>
+/// Gets the word break action.
+/// </summary>
+/// <param name="last">The last char, Extend/Format/ZWJ skipped.</param>
+/// <param name="next">The next char.</param>
+/// <returns>action of boundary between them</returns>
+auto RichED::GetWordBreakAction(WordBreakProperty last, WordBreakProperty next) noexcept -> WordBreakAction {
+    assert(last < WB_COUNT && next < WB_COUNT);
+    return static_cast<WordBreakAction>(impl::wb_pairs.data[last][next]);
+}
+
+/// <summary>
+/// Determines whether char matches ahead/behind action.
+/// </summary>
+/// <param name="act">The action.</param>
+/// <param name="prop">The property of char after next or before last.</param>
+/// <returns>true if no break</returns>
+bool RichED::IsWordBreakMatch(WordBreakAction act, WordBreakProperty prop) noexcept {
+    switch (act)
+    {
+    case WBA_AheadLetter: case WBA_BehindLetter:   return impl::wb_letter(prop);
+    case WBA_AheadHebrew: case WBA_BehindHebrew:   return prop == WB_HebrewLetter;
+    case WBA_AheadNumeric: case WBA_BehindNumeric: return prop == WB_Numeric;
+    default: return false;
+    }
+}
+
+// namespace RichED::impl
+namespace RichED { namespace impl {
+    // is Extend, Format or ZWJ, skipped by word rules [WB4]
+    inline bool word_ignore(WordBreakProperty wb) noexcept {
+        return wb == WB_Extend || wb == WB_Format || wb == WB_ZWJ; }
+    // is Newline, CR or LF
+    inline bool word_newline(WordBreakProperty wb) noexcept {
+        return wb == WB_Newline || wb == WB_CR || wb == WB_LF; }
+    // is ascii letter or digit, fast path of latin text
+    inline bool word_alnum(char32_t ch) noexcept {
+        return uint32_t((ch | 0x20) - 'a') < 26 || uint32_t(ch - '0') < 10; }
+    // is char of script without spaces, segmented by dictionary
+    inline bool word_dict(CharProperty prop) noexcept {
+        const auto gc = prop.Category();
+        return prop.WordBreak() == WB_Other && (gc == GC_Lo || gc == GC_Lm); }
+    // is normal cell
+    inline bool word_normal(const CEDTextCell& cell) noexcept {
+        return cell.RefMetaInfo().metatype == Type_Normal; }
+    // property of next char skipped Extend/Format/ZWJ, WB_COUNT for sot/eot
+    inline auto word_skip(WordCursor& cursor, bool forward) noexcept {
+        while (true) {
+            const auto ch = forward ? cursor.Next() : cursor.Prev();
+            if (ch == CEDWordBreaker::WORD_END) return WB_COUNT;
+            const auto wb = GetCharProperty(ch).WordBreak();
+            if (!word_ignore(wb)) return wb;
+        }
+    }
+    // skip ascii letters and digits inside cell while both sides are
+    inline void word_alnum_forward(WordCursor& cursor) noexcept {
+        const auto& str = cursor.cell->RefString();
+        auto off = cursor.off;
+        if (!off || off >= str.length || !word_normal(*cursor.cell)) return;
+        if (!word_alnum(str.data[off - 1])) return;
+        while (off != str.length && word_alnum(str.data[off])) ++off;
+        cursor.pos += off - cursor.off;
+        cursor.off = off;
+    }
+    // skip ascii letters and digits inside cell while both sides are
+    inline void word_alnum_backward(WordCursor& cursor) noexcept {
+        const auto& str = cursor.cell->RefString();
+        auto off = cursor.off;
+        if (!off || off >= str.length || !word_normal(*cursor.cell)) return;
+        if (!word_alnum(str.data[off])) return;
+        while (off && word_alnum(str.data[off - 1])) --off;
+        cursor.pos -= cursor.off - off;
+        cursor.off = off;
+    }
+}}
+
+/// <summary>
+/// Reads char after cursor and moves forward.
+/// </summary>
+/// <returns>WORD_END if none</returns>
+auto RichED::WordCursor::Next() noexcept -> char32_t {
+    if (!impl::word_normal(*cell)) return CEDWordBreaker::WORD_END;
+    while (off == cell->RefString().length) {
+        if (cell->RefMetaInfo().eol) return CEDWordBreaker::WORD_END;
+        const auto node = static_cast<CEDTextCell*>(cell->next);
+        if (!impl::word_normal(*node)) return CEDWordBreaker::WORD_END;
+        cell = node; off = 0;
+    }
+    const auto& str = cell->RefString();
+    const char16_t unit = str.data[off];
+    char32_t ch = unit;
+    ++off; ++pos;
+    if ((unit & 0xFC00) == 0xD800 && off != str.length && (str.data[off] & 0xFC00) == 0xDC00) {
+        ch = ((ch - 0xD800) << 10 | (str.data[off] - 0xDC00)) + 0x10000;
+        ++off; ++pos;
+    }
+    return ch;
+}
+
+/// <summary>
+/// Reads char before cursor and moves backward.
+/// </summary>
+/// <returns>WORD_END if none</returns>
+auto RichED::WordCursor::Prev() noexcept -> char32_t {
+    while (!off) {
+        if (cell == first) return CEDWordBreaker::WORD_END;
+        const auto node = static_cast<CEDTextCell*>(cell->prev);
+        if (!impl::word_normal(*node)) return CEDWordBreaker::WORD_END;
+        cell = node; off = cell->RefString().length;
+    }
+    if (!impl::word_normal(*cell)) return CEDWordBreaker::WORD_END;
+    const auto& str = cell->RefString();
+    --off; --pos;
+    const char16_t unit = str.data[off];
+    char32_t ch = unit;
+    if ((unit & 0xFC00) == 0xDC00 && off && (str.data[off - 1] & 0xFC00) == 0xD800) {
+        --off; --pos;
+        ch = ((char32_t(str.data[off]) - 0xD800) << 10 | (unit - 0xDC00)) + 0x10000;
+    }
+    return ch;
+}
+
+/// <summary>
+/// Determines whether the specified char is space skipped after word.
+/// </summary>
+/// <param name="ch">The char.</param>
+/// <returns></returns>
+bool RichED::CEDWordBreaker::IsSpace(char32_t ch) noexcept {
+    return ch == '\t' || GetCharProperty(ch).WordBreak() == WB_WSegSpace;
+}
+
+/// <summary>
+/// Checks word boundary at cursor.
+/// </summary>
+/// <param name="cursor">The cursor.</param>
+/// <returns>true if boundary</returns>
+bool RichED::CEDWordBreaker::IsBoundary(const WordCursor& cursor) noexcept {
+    auto before = cursor, after = cursor;
+    const auto a = before.Prev(), b = after.Next();
+    // WB1 sot ÷, WB2 ÷ eot
+    if (a == WORD_END || b == WORD_END) return true;
+    if (impl::word_alnum(a) && impl::word_alnum(b)) return false;
+    const auto pa = GetCharProperty(a), pb = GetCharProperty(b);
+    const auto wb = pb.WordBreak();
+    auto last = pa.WordBreak();
+    // WB3c ZWJ × ExtPict, WB3d WSegSpace × WSegSpace
+    if (last == WB_ZWJ && pb.Pictographic()) return false;
+    if (last == WB_WSegSpace && wb == WB_WSegSpace) return false;
+    // WB4 之前的Extend/Format/ZWJ并入前一字符, 行首或换行后的除外
+    if (!impl::word_ignore(wb)) {
+        while (impl::word_ignore(last)) {
+            const auto ch = before.Prev();
+            if (ch == WORD_END) break;
+            const auto wa = GetCharProperty(ch).WordBreak();
+            if (impl::word_newline(wa)) break;
+            last = wa;
+        }
+    }
+    const auto act = GetWordBreakAction(last, wb);
+    switch (act)
+    {
+    case WBA_Break:
+        return true;
+    case WBA_Keep:
+        return false;
+    case WBA_AheadLetter: case WBA_AheadHebrew: case WBA_AheadNumeric:
+        return !IsWordBreakMatch(act, impl::word_skip(after, true));
+    case WBA_BehindLetter: case WBA_BehindHebrew: case WBA_BehindNumeric:
+        return !IsWordBreakMatch(act, impl::word_skip(before, false));
+    case WBA_RI:
+    default:
+        // 区域指示符两两成对: 之前有奇数个时不断开
+        bool odd = true;
+        while (impl::word_skip(before, false) == WB_RI) odd = !odd;
+        return !odd;
+    }
+}
+
+/// <summary>
+/// Moves over dictionary-segmented word after cursor.
+/// </summary>
+/// <param name="cursor">The cursor.</param>
+/// <returns></returns>
+void RichED::CEDWordBreaker::dict_next(WordCursor& cursor) const noexcept {
+    const auto dict = m_pDict;
+    auto node = dict ? dict->Root(false) : 0;
+    auto itr = cursor;
+    // 没有词典时整段视为一个词
+    if (!node) {
+        while (true) {
+            const auto ch = itr.Next();
+            if (ch == WORD_END) break;
+            const auto prop = GetCharProperty(ch);
+            if (!impl::word_dict(prop) && !impl::word_ignore(prop.WordBreak())) break;
+            cursor = itr;
+        }
+        return;
+    }
+    // 最大正向匹配, 没有匹配时前进一个字符
+    bool found = false;
+    for (uint32_t i = 0; i != WORD_DICT_MAXLEN; ++i) {
+        const auto ch = itr.Next();
+        if (ch == WORD_END) break;
+        const auto prop = GetCharProperty(ch);
+        if (!impl::word_dict(prop) && !impl::word_ignore(prop.WordBreak())) break;
+        if (!(node = dict->Walk(node, ch))) break;
+        if (dict->IsWord(node)) { cursor = itr; found = true; }
+    }
+    if (!found) cursor.Next();
+    // 附带之后的Extend/Format/ZWJ
+    while (true) {
+        itr = cursor;
+        const auto ch = itr.Next();
+        if (ch == WORD_END || !impl::word_ignore(GetCharProperty(ch).WordBreak())) break;
+        cursor = itr;
+    }
+}
+
+/// <summary>
+/// Moves over dictionary-segmented word before cursor.
+/// </summary>
+/// <param name="cursor">The cursor.</param>
+/// <returns></returns>
+void RichED::CEDWordBreaker::dict_prev(WordCursor& cursor) const noexcept {
+    const auto dict = m_pDict;
+    auto node = dict ? dict->Root(true) : 0;
+    auto itr = cursor;
+    // 没有词典时整段视为一个词
+    if (!node) {
+        while (true) {
+            const auto ch = itr.Prev();
+            if (ch == WORD_END) break;
+            const auto prop = GetCharProperty(ch);
+            if (impl::word_dict(prop)) cursor = itr;
+            else if (!impl::word_ignore(prop.WordBreak())) break;
+        }
+        return;
+    }
+    // 最大逆向匹配, 词只能开始于非Extend/Format/ZWJ字符
+    bool found = false;
+    for (uint32_t i = 0; i != WORD_DICT_MAXLEN; ++i) {
+        const auto ch = itr.Prev();
+        if (ch == WORD_END) break;
+        const auto prop = GetCharProperty(ch);
+        const auto base = impl::word_dict(prop);
+        if (!base && !impl::word_ignore(prop.WordBreak())) break;
+        if (!(node = dict->Walk(node, ch))) break;
+        if (base && dict->IsWord(node)) { cursor = itr; found = true; }
+    }
+    if (found) return;
+    // 没有匹配时后退一个字符
+    while (true) {
+        const auto ch = cursor.Prev();
+        if (ch == WORD_END || impl::word_dict(GetCharProperty(ch))) break;
+    }
+}
+
+/// <summary>
+/// Moves cursor to next word boundary.
+/// </summary>
+/// <param name="cursor">The cursor.</param>
+/// <returns>false if none</returns>
+bool RichED::CEDWordBreaker::Next(WordCursor& cursor) const noexcept {
+    auto itr = cursor;
+    const auto ch = itr.Next();
+    if (ch == WORD_END) return false;
+    if (impl::word_dict(GetCharProperty(ch))) {
+        this->dict_next(cursor);
+        return true;
+    }
+    // 逐字符检查边界, ASCII字母数字连续出现时直接跳过
+    cursor = itr;
+    while (true) {
+        impl::word_alnum_forward(cursor);
+        if (CEDWordBreaker::IsBoundary(cursor)) return true;
+        cursor.Next();
+    }
+}
+
+/// <summary>
+/// Moves cursor to previous word boundary.
+/// </summary>
+/// <param name="cursor">The cursor.</param>
+/// <returns>false if none</returns>
+bool RichED::CEDWordBreaker::Prev(WordCursor& cursor) const noexcept {
+    auto itr = cursor;
+    auto ch = itr.Prev();
+    if (ch == WORD_END) return false;
+    // Extend/Format/ZWJ属于之前的字符
+    auto prop = GetCharProperty(ch);
+    while (impl::word_ignore(prop.WordBreak())) {
+        if ((ch = itr.Prev()) == WORD_END) break;
+        prop = GetCharProperty(ch);
+    }
+    if (ch != WORD_END && impl::word_dict(prop)) {
+        this->dict_prev(cursor);
+        return true;
+    }
+    cursor.Prev();
+    while (true) {
+        impl::word_alnum_backward(cursor);
+        if (CEDWordBreaker::IsBoundary(cursor)) return true;
+        cursor.Prev();
+    }
+}
@@ -0,0 +1,165 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ed_txtprop.h"
+
+// RichED namespace
+namespace RichED {
+    // get line break class of char
+    auto GetLineBreakClass(char32_t ch) noexcept->LineBreakClass;
+    // masks of classified utf-16 units, bit i for unit i
+    struct CharMasks {
+        // ' '
+        uint32_t    space;
+        // ascii letter or digit
+        uint32_t    alnum;
+        // cjk unified ideograph in bmp, class ID
+        uint32_t    cjk;
+        // surrogate
+        uint32_t    surrogate;
+    };
+    // classify utf-16 units, len <= 32
+    void ClassifyChars(const char16_t* str, uint32_t len, CharMasks& masks) noexcept;
+    // first set bit in [begin, end), end if none
+    auto FindBitForward(const uint32_t* bits, uint32_t begin, uint32_t end) noexcept->uint32_t;
+    // last set bit in [begin, end), end if none
+    auto FindBitBackward(const uint32_t* bits, uint32_t begin, uint32_t end) noexcept->uint32_t;
+    // line breaker [UAX #14]: fed char by char in one linear pass,
+    // reports break opportunities before each char
+    class CEDLineBreaker {
+    public:
+        // ctor, keep_all: CJK treated as AL, break at spaces and punctuation only
+        CEDLineBreaker(bool keep_all = false) noexcept : m_bKeepAll(keep_all) {}
+        // feed char class, return true if break allowed before it
+        bool Feed(LineBreakClass cls) noexcept;
+        // feed utf-16 string, set bit [offset + i] of bits if break allowed before str[i]
+        void Feed(const char16_t* str, uint32_t len, uint32_t* bits, uint32_t offset) noexcept;
+    private:
+        // feed one char at str[i], return unit count
+        auto feed_char(const char16_t* str, uint32_t i, uint32_t len, uint32_t* bits, uint32_t offset) noexcept->uint32_t;
+    private:
+        // class of last char except SP and CM, LB_COUNT for start of text
+        LineBreakClass      m_clsLast = LB_COUNT;
+        // regional indicator count of last run
+        uint8_t             m_cRI = 0;
+        // last char is SP
+        bool                m_bSpace = false;
+        // last char is ZWJ
+        bool                m_bZWJ = false;
+        // keep all
+        bool                m_bKeepAll;
+    };
+    // grapheme cluster breaker [UAX #29]: state packed in 8 bits so it can be
+    // saved at any point and resumed later
+    class CEDGraphemeBreaker {
+    public:
+        // state at start of text
+        enum : uint8_t { STATE_SOT = GB_COUNT };
+        // ctor
+        CEDGraphemeBreaker(uint8_t state = STATE_SOT) noexcept : m_state(state) {}
+        // get state
+        auto GetState() const noexcept { return m_state; }
+        // feed char property, return true if cluster breaks before it
+        bool Feed(CharProperty prop) noexcept;
+        // feed utf-16 string, set bit [offset + i] of bits if cluster breaks before str[i],
+        // return true if state after still depends on state before
+        bool Feed(const char16_t* str, uint32_t len, uint32_t* bits, uint32_t offset) noexcept;
+    private:
+        // [0, 4): property of last char, [4]: odd regional indicator run,
+        // [5, 7): emoji sequence, 1 for ExtPict Extend*, 2 for ExtPict Extend* ZWJ
+        uint8_t             m_state;
+    };
+    // action of word boundary [UAX #29] between last and next char
+    enum WordBreakAction : uint8_t {
+        // break
+        WBA_Break = 0,
+        // no break
+        WBA_Keep,
+        // no break if char after next is AHLetter, Hebrew_Letter or Numeric [WB6, WB7b, WB12]
+        WBA_AheadLetter, WBA_AheadHebrew, WBA_AheadNumeric,
+        // no break if char before last is AHLetter, Hebrew_Letter or Numeric [WB7, WB7c, WB11]
+        WBA_BehindLetter, WBA_BehindHebrew, WBA_BehindNumeric,
+        // no break if odd regional indicators before [WB15, WB16]
+        WBA_RI,
+    };
+    // get word boundary action of [last, next], Extend/Format/ZWJ skipped [WB4],
+    // rules on adjacent chars [WB3c, WB3d] checked by caller
+    auto GetWordBreakAction(WordBreakProperty last, WordBreakProperty next) noexcept->WordBreakAction;
+    // check char before last or after next for ahead/behind action, WB_COUNT for sot/eot
+    bool IsWordBreakMatch(WordBreakAction act, WordBreakProperty prop) noexcept;
+    // word dictionary for scripts written without spaces[CJK, Thai...],
+    // walked as trie char by char, owned by caller
+    struct PCN_NOVTABLE IEDWordDictionary {
+        // root node, trie of reversed words if backward, 0 if not supported
+        virtual auto Root(bool backward) noexcept->uint32_t = 0;
+        // child node of char, 0 for none
+        virtual auto Walk(uint32_t node, char32_t ch) noexcept->uint32_t = 0;
+        // a word ends at node
+        virtual bool IsWord(uint32_t node) noexcept = 0;
+    };
+    // cell
+    class CEDTextCell;
+    // char cursor in logic line for word breaker, walks normal cells only, other cells as sot/eot
+    struct WordCursor {
+        // first cell of logic line
+        CEDTextCell*    first;
+        // current cell
+        CEDTextCell*    cell;
+        // offset in cell
+        uint32_t        off;
+        // offset in logic line
+        uint32_t        pos;
+        // read char after cursor and move forward, WORD_END if none
+        auto Next() noexcept->char32_t;
+        // read char before cursor and move backward, WORD_END if none
+        auto Prev() noexcept->char32_t;
+    };
+    // word breaker [UAX #29]: moves cursor word by word, words of scripts written
+    // without spaces segmented by dictionary, whole run as one word without dictionary
+    class CEDWordBreaker {
+    public:
+        // end of text read by cursor
+        enum : char32_t { WORD_END = char32_t(-1) };
+        // ctor, dictionary not owned, null for none
+        CEDWordBreaker(IEDWordDictionary* dict) noexcept : m_pDict(dict) {}
+        // move cursor to next word boundary, false if none
+        bool Next(WordCursor& cursor) const noexcept;
+        // move cursor to previous word boundary, false if none
+        bool Prev(WordCursor& cursor) const noexcept;
+        // check word boundary at cursor, dictionary not used
+        static bool IsBoundary(const WordCursor& cursor) noexcept;
+        // is space skipped after word
+        static bool IsSpace(char32_t ch) noexcept;
+    private:
+        // move over dictionary-segmented word after cursor
+        void dict_next(WordCursor& cursor) const noexcept;
+        // move over dictionary-segmented word before cursor
+        void dict_prev(WordCursor& cursor) const noexcept;
+    private:
+        // word dictionary
+        IEDWordDictionary*  m_pDict;
+    };
+}
@@ -3,6 +3,7 @@
 #include "ed_txtplat.h"
 #include <cstdlib>
 #include <cstring>
+#include <utility>
 
 
 /// <summary>
@@ -65,6 +66,145 @@ bool RichED::impl::buffer_base::resize_buffer(
     return true;
 }
 
+PCN_NOINLINE
+/// <summary>
+/// Reserves the buffer, data beyond length kept.
+/// </summary>
+/// <param name="len">The length.</param>
+/// <param name="size_of">The size of.</param>
+/// <param name="plat">The plat.</param>
+/// <returns></returns>
+bool RichED::impl::buffer_base::reserve_buffer(
+    uint32_t len, size_t size_of, IEDTextPlatform& plat) noexcept {
+    if (len <= m_capacity) return true;
+    void* new_ptr = nullptr;
+    for (size_t i = 0; ; ++i) {
+        if ((new_ptr = RichED::ReAlloc(m_data, size_of * len))) break;
+        if (plat.OnOOM(i, size_of * len) == OOM_Ignore) break;
+    }
+    // 内存不足
+    if (!new_ptr) {
+        m_length = 0;
+        m_capacity = 0;
+        RichED::Free(m_data);
+        m_data = nullptr;
+        return false;
+    }
+    m_data = new_ptr;
+    m_capacity = len;
+    return true;
+}
+
+/// <summary>
+/// Finalizes an instance of the <see cref="gap_buffer_base"/> class.
+/// </summary>
+/// <returns></returns>
+RichED::impl::gap_buffer_base::~gap_buffer_base() noexcept {
+    if (m_data) RichED::Free(m_data);
+}
+
+/// <summary>
+/// Swaps with the specified buffer.
+/// </summary>
+/// <param name="other">The other.</param>
+/// <returns></returns>
+void RichED::impl::gap_buffer_base::swap_gap(gap_buffer_base& other) noexcept {
+    std::swap(m_data, other.m_data);
+    std::swap(m_length, other.m_length);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_gap, other.m_gap);
+}
+
+PCN_NOINLINE
+/// <summary>
+/// Reserves the capacity, gap moved to the end.
+/// </summary>
+/// <param name="len">The length.</param>
+/// <param name="size_of">The size of.</param>
+/// <param name="plat">The plat.</param>
+/// <returns></returns>
+bool RichED::impl::gap_buffer_base::reserve_gap(
+    uint32_t len, size_t size_of, IEDTextPlatform& plat) noexcept {
+    if (len <= m_capacity) return true;
+    // 间隙后面的数据需要移动到新的末尾, 这里先把间隙移到最后
+    this->move_gap(m_length, size_of);
+    void* new_ptr = nullptr;
+    for (size_t i = 0; ; ++i) {
+        if ((new_ptr = RichED::ReAlloc(m_data, size_of * len))) break;
+        if (plat.OnOOM(i, size_of * len) == OOM_Ignore) break;
+    }
+    // 内存不足: 保留原数据
+    if (!new_ptr) return false;
+    m_data = new_ptr;
+    m_capacity = len;
+    return true;
+}
+
+/// <summary>
+/// Moves the gap to pos.
+/// </summary>
+/// <param name="pos">The position.</param>
+/// <param name="size_of">The size of.</param>
+/// <returns></returns>
+void RichED::impl::gap_buffer_base::move_gap(uint32_t pos, size_t size_of) noexcept {
+    assert(pos <= m_length);
+    const auto ptr = reinterpret_cast<char*>(m_data);
+    const size_t gap = m_capacity - m_length;
+    // 间隙前移: [pos, gap) 移动到间隙后面
+    if (pos < m_gap) {
+        const size_t count = m_gap - pos;
+        std::memmove(ptr + (pos + gap) * size_of, ptr + pos * size_of, count * size_of);
+    }
+    // 间隙后移: 间隙后面[gap, pos)移动到前面
+    else if (pos > m_gap) {
+        const size_t count = pos - m_gap;
+        std::memmove(ptr + m_gap * size_of, ptr + (m_gap + gap) * size_of, count * size_of);
+    }
+    m_gap = pos;
+}
+
+/// <summary>
+/// Inserts elements at pos.
+/// </summary>
+/// <param name="pos">The position.</param>
+/// <param name="count">The count.</param>
+/// <param name="size_of">The size of.</param>
+/// <param name="plat">The plat.</param>
+/// <returns>pointer to the inserted elements, null if failed</returns>
+void* RichED::impl::gap_buffer_base::insert_gap(
+    uint32_t pos, uint32_t count, size_t size_of, IEDTextPlatform& plat) noexcept {
+    const auto len = m_length + count;
+    // 间隙不够: 成倍扩容, 均摊O(1)
+    if (len > m_capacity) {
+        const auto cap = m_capacity * 2 > len ? m_capacity * 2 : len;
+        if (!this->reserve_gap(cap, size_of, plat)) return nullptr;
+    }
+    this->move_gap(pos, size_of);
+    const auto ptr = reinterpret_cast<char*>(m_data) + pos * size_of;
+#ifndef NDEBUG
+    std::memset(ptr, 0xfc, size_of * count);
+#endif
+    m_gap += count;
+    m_length = len;
+    return ptr;
+}
+
+/// <summary>
+/// Removes elements at pos.
+/// </summary>
+/// <param name="pos">The position.</param>
+/// <param name="count">The count.</param>
+/// <param name="size_of">The size of.</param>
+/// <returns></returns>
+void RichED::impl::gap_buffer_base::remove_gap(
+    uint32_t pos, uint32_t count, size_t size_of) noexcept {
+    assert(pos + count <= m_length);
+    // 间隙移到删除区间后面, 然后前扩
+    this->move_gap(pos + count, size_of);
+    m_gap = pos;
+    m_length -= count;
+}
+
 #ifndef RED_CUSTOM_ALLOCFUNC
 
 /// <summary>
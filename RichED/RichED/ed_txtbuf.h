@@ -44,6 +44,8 @@ namespace RichED {
         protected:
             // resize buffer
             bool resize_buffer(uint32_t, size_t size_of, IEDTextPlatform&) noexcept;
+            // reserve buffer, data beyond length kept
+            bool reserve_buffer(uint32_t, size_t size_of, IEDTextPlatform&) noexcept;
             // is ok?
             bool is_ok() const noexcept { return !!m_data; }
             // is failed?
@@ -62,6 +64,37 @@ namespace RichED {
             // capacity of data
             uint32_t            m_capacity = 0;
         };
+        // gap buffer base class
+        class gap_buffer_base {
+        protected:
+            // ctor
+            gap_buffer_base() noexcept {}
+            // dtor
+            ~gap_buffer_base() noexcept;
+        protected:
+            // reserve capacity
+            bool reserve_gap(uint32_t, size_t size_of, IEDTextPlatform&) noexcept;
+            // insert elements, return pointer to them, null if failed
+            void*insert_gap(uint32_t pos, uint32_t count, size_t size_of, IEDTextPlatform&) noexcept;
+            // remove elements
+            void remove_gap(uint32_t pos, uint32_t count, size_t size_of) noexcept;
+            // move gap to pos
+            void move_gap(uint32_t pos, size_t size_of) noexcept;
+            // swap with other buffer
+            void swap_gap(gap_buffer_base&) noexcept;
+            // map index to buffer
+            auto map_index(uint32_t i) const noexcept {
+                assert(i < m_length); return i < m_gap ? i : i + (m_capacity - m_length); }
+        protected:
+            // data pointer
+            void*               m_data = nullptr;
+            // length of data, gap excluded
+            uint32_t            m_length = 0;
+            // capacity of data
+            uint32_t            m_capacity = 0;
+            // gap begin
+            uint32_t            m_gap = 0;
+        };
     }
     // buffer class
     template<typename T> class CEDBuffer: public impl::buffer_base {
@@ -84,10 +117,16 @@ namespace RichED {
         bool Resize(uint32_t l, IEDTextPlatform& p) noexcept { return this->resize_buffer(l, sizeof(T), p); }
         // reduce size
         void ReduceSize(uint32_t l) noexcept { this->assert_size(l); m_length = l; }
+        // reserve capacity, data beyond size kept
+        bool Reserve(uint32_t l, IEDTextPlatform& p) noexcept { return this->reserve_buffer(l, sizeof(T), p); }
+        // expand size in capacity, data beyond size kept
+        void ExpandSize(uint32_t l) noexcept { assert(l <= m_capacity); m_length = l; }
         // full
         auto IsFull() const noexcept { return m_length == m_capacity; }
         // get size
         auto GetSize() const noexcept { return m_length; }
+        // get capacity
+        auto GetCapacity() const noexcept { return m_capacity; }
         // get data
         auto GetData() noexcept { return tr(m_data); }
         // is ok
@@ -115,4 +154,41 @@ namespace RichED {
         // get const at
         const auto&cat(uint32_t i) const noexcept { assert_index(i); return tr(m_data)[i]; }
     };
+    // gap buffer class, gap moved to edit point so inserting/removing near it is cheap
+    template<typename T> class CEDGapBuffer: public impl::gap_buffer_base {
+        // tptr / const tptr
+        using tptr = T * ; using cptr = const T*;
+        // must be pod
+        static_assert(std::is_pod<T>::value, "must be pod");
+        // tr pointer
+        static tptr tr(void* ptr) noexcept { return reinterpret_cast<T*>(ptr); }
+    public:
+        // ctor
+        CEDGapBuffer() noexcept {}
+        // dtor
+        ~CEDGapBuffer() noexcept {}
+        // reserve
+        bool Reserve(uint32_t l, IEDTextPlatform& p) noexcept { return this->reserve_gap(l, sizeof(T), p); }
+        // insert count elements at pos, return pointer to them[contiguous with pos - 1]
+        auto Insert(uint32_t pos, uint32_t count, IEDTextPlatform& p) noexcept { return tr(this->insert_gap(pos, count, sizeof(T), p)); }
+        // remove count elements at pos
+        void Remove(uint32_t pos, uint32_t count) noexcept { this->remove_gap(pos, count, sizeof(T)); }
+        // get size
+        auto GetSize() const noexcept { return m_length; }
+        // get capacity
+        auto GetCapacity() const noexcept { return m_capacity; }
+        // is ok
+        bool IsOK() const noexcept { return !!m_data; }
+        // is failed
+        bool IsFailed() const noexcept { return !m_data; }
+        // clear
+        void Clear() noexcept { m_length = 0; m_gap = 0; }
+        // swap
+        void Swap(CEDGapBuffer& other) noexcept { this->swap_gap(other); }
+    public:
+        // operaotr[]
+        auto&operator[](uint32_t index) noexcept { return tr(m_data)[this->map_index(index)]; }
+        // operaotr[]
+        auto&operator[](uint32_t index) const noexcept { return static_cast<cptr>(m_data)[this->map_index(index)]; }
+    };
 }
\ No newline at end of file
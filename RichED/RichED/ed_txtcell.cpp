@@ -7,11 +7,6 @@
 
 // namespace Riched::detail
 namespace RichED { namespace impl {
-    // clear all
-    inline auto&clear_all(CEDTextDocument& doc, CEDTextCell* cell) noexcept {
-        std::memset(cell, 0, sizeof(*cell));
-        return doc;
-    }
     /// <summary>
     /// Estimates the specified cell.
     /// </summary>
@@ -36,9 +31,9 @@ namespace RichED { namespace impl {
     /// <returns></returns>
     void insert(FixedStringA& obj, uint32_t pos, const char16_t* str, uint32_t len) noexcept {
         // TODO: utf-16 双字断言
-        assert(obj.capacity == TEXT_CELL_STR_MAXLEN);
+        assert(obj.capacity <= TEXT_CELL_STR_MAXLEN);
         assert(len <= uint32_t(obj.capacity + 1) && "out of range");
-        assert(obj.length + len <= TEXT_CELL_STR_MAXLEN + 1 && "out of range");
+        assert(obj.length + len <= uint32_t(obj.capacity + 1) && "out of range");
         assert(pos <= obj.length);
         const size_t moved = (obj.length - pos) * sizeof(obj.data[0]);
         std::memmove(obj.data + pos + len, obj.data + pos, moved);
@@ -54,18 +49,14 @@ namespace RichED { namespace impl {
     /// <returns></returns>
     void erase(FixedStringA& obj, uint32_t pos, uint32_t len) noexcept {
         // TODO: utf-16 双字断言
-        assert(obj.capacity == TEXT_CELL_STR_MAXLEN);
+        assert(obj.capacity <= TEXT_CELL_STR_MAXLEN);
         assert(len <= obj.length && "out of range");
         assert(pos + len <= obj.length && "out of range");
         assert(obj.length <= TEXT_CELL_STR_MAXLEN + 1 && "out of length");
-        const size_t moved = (obj.length - pos) * sizeof(obj.data[0]);
+        const size_t moved = (obj.length - pos - len) * sizeof(obj.data[0]);
         std::memmove(obj.data + pos, obj.data + pos + len, moved);
         obj.length -= len;
     }
-    // is same?
-    inline auto not_same(const RichData& a, const RichData& b) noexcept {
-        return std::memcmp(&a, &b, sizeof(a));
-    }
 }}
 
 
@@ -77,8 +68,12 @@ namespace RichED { namespace impl {
 /// <returns></returns>
 void RichED::CEDTextCell::Dispose() noexcept {
     //delete this;
+    auto& doc = this->doc;
+    const uint32_t pool = m_pool;
+    if (this->index.priority) doc.RefCellIndex().Remove(*this);
     this->~CEDTextCell();
-    RichED::Free(this);
+    if (pool) doc.FreeCell(this, pool - 1);
+    else RichED::Free(this);
 }
 
 /// <summary>
@@ -93,10 +88,10 @@ void RichED::CEDTextCell::Sleep() noexcept {
 /// Initializes a new instance of the <see cref="CEDTextCell" /> class.
 /// </summary>
 /// <param name="doc">The document.</param>
-/// <param name="red">The red.</param>
-RichED::CEDTextCell::CEDTextCell(CEDTextDocument& doc, const RichData& red) noexcept
-    : doc(impl::clear_all(doc, this)) {
-    m_riched = red;
+/// <param name="style">The style.</param>
+RichED::CEDTextCell::CEDTextCell(CEDTextDocument& doc, uint16_t style) noexcept
+    : CEDTextCellHead(doc), Node(), m_meta(), m_pool(), m_style(style), m_string() {
+    const auto& red = doc.RefStyle(style);
     this->metrics.ar_height = this->metrics.bounding.bottom = red.size;
 }
 
@@ -112,12 +107,15 @@ RichED::CEDTextCell::~CEDTextCell() noexcept {
 
 
 /// <summary>
-/// Sets the rich ed.
+/// Sets the style.
 /// </summary>
-/// <param name="data">The data.</param>
+/// <param name="style">The style.</param>
 /// <returns></returns>
-void RichED::CEDTextCell::SetRichED(const RichData& data) noexcept {
-    m_riched = data;
+void RichED::CEDTextCell::SetStyle(uint16_t style) noexcept {
+    // 颜色、效果只在渲染时使用, 字体不变的话上下文仍然有效
+    const bool same = CEDStyleTable::SameFont(doc.RefStyle(m_style), doc.RefStyle(style));
+    m_style = style;
+    if (same) return;
     impl::estimate(*this);
     m_meta.dirty = true;
 }
@@ -151,44 +149,51 @@ void RichED::CEDTextCell::MoveEOL(CEDTextCell & cell) noexcept {
 /// <returns></returns>
 auto RichED::CEDTextCell::SplitEx(uint32_t pos) noexcept -> CEDTextCell* {
     if (pos == 0) return this;
-    if (const auto cell = RichED::CreateNormalCell(this->doc, m_riched)) {
+    const uint32_t len_after = pos < m_string.length ? m_string.length - pos : 0;
+    if (const auto cell = RichED::CreateNormalCell(this->doc, m_style, len_after)) {
         // 复制信息
-        cell->m_riched = m_riched;
         cell->m_meta.eol = m_meta.eol;
         m_meta.eol = false;
         // 复制文本
         if (pos < m_string.length) {
             assert(m_meta.metatype < Type_UnderRuby && "cannot split this");
-            const auto len_after = m_string.length - pos;
             cell->InsertText(0, {
                 m_string.data + pos,
                 m_string.data + m_string.length
                 });
             this->RemoveText({ pos, len_after });
         }
-        RichED::InsertAfterFirst(*this, *cell);
+        RichED::InsertCellAfter(*this, *cell);
         return cell;
     }
     return nullptr;
 }
 
 /// <summary>
-/// Merges the with next.
+/// Determines whether this can merge with next.
 /// </summary>
 /// <returns></returns>
-bool RichED::CEDTextCell::MergeWithNext() noexcept {
+bool RichED::CEDTextCell::CanMergeWithNext() const noexcept {
     assert(this->next && this->prev && "bad action");
     // 不能融合EOL
     if (m_meta.eol) return false;
     assert(this->next->next && "bad action");
-    const auto next_cell = static_cast<CEDTextCell*>(this->next);
+    const auto next_cell = static_cast<const CEDTextCell*>(this->next);
     // 各种检查
-    if (next_cell->m_string.length <= TEXT_MERGE_LEN) {
-        if (next_cell->m_meta.metatype | m_meta.metatype) return false;
-        const auto all_len = m_string.length + next_cell->m_string.length;
-        assert(m_string.capacity == TEXT_CELL_STR_MAXLEN);
-        if (all_len > TEXT_CELL_STR_MAXLEN) return false;
-        if (impl::not_same(m_riched, next_cell->m_riched)) return false;
+    if (next_cell->m_string.length > TEXT_MERGE_LEN) return false;
+    if (next_cell->m_meta.metatype | m_meta.metatype) return false;
+    const auto all_len = m_string.length + next_cell->m_string.length;
+    if (all_len > m_string.capacity) return false;
+    return m_style == next_cell->m_style;
+}
+
+/// <summary>
+/// Merges the with next.
+/// </summary>
+/// <returns></returns>
+bool RichED::CEDTextCell::MergeWithNext() noexcept {
+    const auto next_cell = static_cast<CEDTextCell*>(this->next);
+    if (this->CanMergeWithNext()) {
         U16View view;
         view.first = next_cell->m_string.data;
         view.second = next_cell->m_string.data + next_cell->m_string.length;
@@ -205,6 +210,32 @@ bool RichED::CEDTextCell::MergeWithNext() noexcept {
     return false;
 }
 
+/// <summary>
+/// Merges the next cell into this, this cell may be moved into bigger class.
+/// </summary>
+/// <returns>this or new cell, null if failed</returns>
+auto RichED::CEDTextCell::MergeWithNextEx() noexcept -> CEDTextCell* {
+    assert(this->next && this->prev && "bad action");
+    // 不能融合EOL
+    if (m_meta.eol) return nullptr;
+    assert(this->next->next && "bad action");
+    const auto next_cell = static_cast<CEDTextCell*>(this->next);
+    // 仅合并同格式的普通CELL
+    if (next_cell->m_meta.metatype | m_meta.metatype) return nullptr;
+    if (m_style != next_cell->m_style) return nullptr;
+    const auto len = next_cell->m_string.length;
+    if (m_string.length + len > TEXT_CELL_STR_MAXLEN) return nullptr;
+    // 容量不够则扩容, this可能失效
+    const auto cell = this->Reserve(len);
+    if (!cell) return nullptr;
+    cell->InsertText(cell->m_string.length, next_cell->View());
+    // 传递EOL
+    cell->m_meta.eol = next_cell->m_meta.eol;
+    // 删除节点
+    next_cell->DisposeEx();
+    return cell;
+}
+
 /// <summary>
 /// Removes the text.
 /// </summary>
@@ -215,10 +246,13 @@ void RichED::CEDTextCell::RemoveText(Range range) noexcept {
     if (!range.len) return;
     // 直接删除
     impl::erase(m_string, range.pos, range.len);
+    if (this->index.priority)
+        this->doc.RefCellIndex().Update(*this, -int32_t(range.len));
     // 进行估计
     impl::estimate(*this);
     // 标记为脏
     m_meta.dirty = true;
+    m_meta.segmented = false;
 }
 
 /// <summary>
@@ -247,10 +281,42 @@ void RichED::CEDTextCell::InsertText(uint32_t pos, U16View view) noexcept {
     // 计算插入长度
     const uint32_t len = static_cast<uint32_t>(view.second - view.first);
     impl::insert(m_string, pos, view.first, len);
+    if (this->index.priority)
+        this->doc.RefCellIndex().Update(*this, int32_t(len));
     // 进行估计
     impl::estimate(*this);
     // 标记为脏
     m_meta.dirty = true;
+    m_meta.segmented = false;
+}
+
+/// <summary>
+/// Reserves for inserting text, move this cell into bigger class if needed.
+/// </summary>
+/// <param name="len">The length.</param>
+/// <returns>this or new cell, null if failed</returns>
+auto RichED::CEDTextCell::Reserve(uint32_t len) noexcept -> CEDTextCell* {
+    const uint32_t need = m_string.length + len;
+    if (need <= m_string.capacity) return this;
+    // 只有普通CELL能够扩容
+    if (!m_pool || m_meta.metatype >= Type_UnderRuby) return nullptr;
+    if (need > TEXT_CELL_STR_MAXLEN) return nullptr;
+    const auto index = RichED::GetCellClass(need);
+    const auto ptr = this->doc.AllocCell(index);
+    if (!ptr) return nullptr;
+    // 复制CELL以及文本, 上下文一并转移
+    const auto src = reinterpret_cast<const char*>(this);
+    const auto end = reinterpret_cast<const char*>(m_string.data + m_string.length);
+    std::memcpy(ptr, src, end - src);
+    const auto cell = reinterpret_cast<CEDTextCell*>(ptr);
+    cell->m_string.capacity = GetCellClassCapacity(index);
+    cell->m_pool = index + 1;
+    // 替换节点
+    this->prev->next = cell;
+    this->next->prev = cell;
+    if (this->index.priority) this->doc.RefCellIndex().Relocate(*this, *cell);
+    this->doc.FreeCell(this, m_pool - 1);
+    return cell;
 }
 
 /// <summary>
@@ -271,8 +337,9 @@ namespace RichED {
     // shrinked cell
     struct CEDTextCellPublic : CEDTextCell {
         // ctor
-        CEDTextCellPublic(CEDTextDocument&d, const RichData& red, uint32_t capacity) noexcept : CEDTextCell(d, red) {
-            m_string.capacity = TEXT_CELL_STR_MAXLEN;
+        CEDTextCellPublic(CEDTextDocument&d, uint16_t style, uint32_t capacity, uint32_t pool) noexcept : CEDTextCell(d, style) {
+            m_string.capacity = capacity;
+            m_pool = pool;
         }
     };
     PCN_NOINLINE
@@ -280,33 +347,52 @@ namespace RichED {
     /// Creates the cell.
     /// </summary>
     /// <param name="doc">The document.</param>
-    /// <param name="red">The red.</param>
+    /// <param name="style">The style.</param>
     /// <param name="capacity">The capacity.</param>
     /// <param name="extra">The extra.</param>
     /// <returns></returns>
-    auto CreatePublicCell(CEDTextDocument& doc, const RichData& red, 
+    auto CreatePublicCell(CEDTextDocument& doc, uint16_t style, 
         uint32_t exlen, uint32_t capacity) noexcept -> CEDTextCell* {
         const size_t len = sizeof(CEDTextCellPublic) + exlen;
         const auto ptr = doc.Alloc(len);
         if (!ptr) return nullptr;
         assert((uintptr_t(ptr) & (alignof(CEDTextCellPublic) - 1)) == 0);
-        return new(ptr) CEDTextCellPublic{ doc, red, capacity };
+        return new(ptr) CEDTextCellPublic{ doc, style, capacity, 0 };
     }
     /// <summary>
     /// Creates the normal cell.
     /// </summary>
     /// <param name="doc">The document.</param>
+    /// <param name="style">The style.</param>
+    /// <param name="len">The length.</param>
     /// <returns></returns>
-    auto CreateNormalCell(CEDTextDocument& doc, const RichData& red) -> CEDTextCell* {
-        return CreatePublicCell(doc, red, sizeof(FixedStringB), TEXT_CELL_STR_MAXLEN);
+    auto CreateNormalCell(CEDTextDocument& doc, uint16_t style, uint32_t len) -> CEDTextCell* {
+        // 根据长度选择CELL类别, 从池中申请
+        const auto index = RichED::GetCellClass(len);
+        const auto ptr = doc.AllocCell(index);
+        if (!ptr) return nullptr;
+        assert((uintptr_t(ptr) & (alignof(CEDTextCellPublic) - 1)) == 0);
+        return new(ptr) CEDTextCellPublic{ doc, style, GetCellClassCapacity(index), index + 1 };
     }
     /// <summary>
     /// Creates the shrinked cell.
     /// </summary>
     /// <param name="doc">The document.</param>
-    /// <param name="red">The red.</param>
+    /// <param name="style">The style.</param>
+    /// <returns></returns>
+    auto CreateShrinkedCell(CEDTextDocument& doc, uint16_t style) -> CEDTextCell* {
+        return CreateNormalCell(doc, style, 2);
+    }
+    /// <summary>
+    /// Inserts the cell after node.
+    /// </summary>
+    /// <param name="node">The node.</param>
+    /// <param name="cell">The cell.</param>
     /// <returns></returns>
-    auto CreateShrinkedCell(CEDTextDocument& doc, const RichData& red) -> CEDTextCell* {
-        return CreatePublicCell(doc, red, sizeof(FixedStringB), 1);
+    void InsertCellAfter(Node& node, CEDTextCell& cell) noexcept {
+        RichED::InsertAfterFirst(node, cell);
+        // 头节点的prev不可靠(尾节点当作CELL时会被覆盖), 直接比较地址
+        const auto prev = cell.doc.IsHead(node) ? nullptr : static_cast<CEDTextCell*>(&node);
+        cell.doc.RefCellIndex().Insert(prev, cell);
     }
 }
@@ -25,16 +25,36 @@
 */
 
 #include "ed_common.h"
+#include "ed_txtdoc.h"
 
 // RichED namespace
 namespace RichED {
     // text document
     class CEDTextDocument;
+    // text cell head, placed before the node:
+    // metrics(layout part at the end) + node + meta + style + length are contiguous
+    class CEDTextCellHead {
+    protected:
+        // ctor
+        CEDTextCellHead(CEDTextDocument&doc) noexcept
+            : doc(doc), ctx(), index(), metrics(), clusters() {}
+    public:
+        // document
+        CEDTextDocument&        doc;
+        // context
+        CellContext             ctx;
+        // index node
+        CellIndexNode           index;
+        // metrics
+        CellMetrics             metrics;
+        // grapheme clusters
+        CellClusters            clusters;
+    };
     // text cell
-    class CEDTextCell : public CEDSmallObject, public Node {
+    class CEDTextCell : public CEDSmallObject, public CEDTextCellHead, public Node {
     protected:
         // ctor
-        CEDTextCell(CEDTextDocument&doc, const RichData&) noexcept;
+        CEDTextCell(CEDTextDocument&doc, uint16_t style) noexcept;
         // dtor
         ~CEDTextCell() noexcept;
     public:
@@ -53,19 +73,27 @@ namespace RichED {
         // get logic length
         //auto GetLogicLength() const noexcept->uint32_t;
         // get riched data
-        auto&RefRichED() const noexcept { return m_riched; }
-        // set new riched
-        void SetRichED(const RichData&) noexcept;
+        auto&RefRichED() const noexcept { return this->doc.RefStyle(m_style); }
+        // get style id
+        auto GetStyle() const noexcept { return m_style; }
+        // set new style, dirty only if font changed
+        void SetStyle(uint16_t) noexcept;
+        // remap style id to same riched-data in new style table
+        void RemapStyle(uint16_t style) noexcept { m_style = style; }
         // clean!
         void AsClean() noexcept { m_meta.dirty = false; }
         // dirty!
         void AsDirty() noexcept { m_meta.dirty = true; }
+        // clusters computed!
+        void AsSegmented() noexcept { m_meta.segmented = true; }
         // eol!
         void AsEOL() noexcept { m_meta.eol = true; }
         // !eol
         void ClearEOL() noexcept { m_meta.eol = false; }
         // get extra info
         auto GetExtraInfo() noexcept { return reinterpret_cast<InlineInfo*>(this + 1); }
+        // allocated from cell pool?
+        bool IsPooled() const noexcept { return !!m_pool; }
     public:
         // split to 2 cells, return this if pos == 0, return next if pos >= len
         auto Split(uint32_t pos) noexcept->CEDTextCell*;
@@ -73,33 +101,50 @@ namespace RichED {
         auto SplitEx(uint32_t pos) noexcept->CEDTextCell*;
         // move eol to cell
         void MoveEOL(CEDTextCell& cell) noexcept;
+        // can merge this with next cell
+        bool CanMergeWithNext() const noexcept;
         // merge this with next cell, return true if success
         bool MergeWithNext() noexcept;
+        // merge next cell into this up to max length, return this or moved cell, null if failed
+        auto MergeWithNextEx() noexcept->CEDTextCell*;
         // remove text
         void RemoveText(Range) noexcept;
         // remove text - ex, call dispose-ex if remove all
         void RemoveTextEx(Range) noexcept;
         // insert text
         void InsertText(uint32_t pos, U16View) noexcept;
-    protected:
-        // riched-data
-        RichData                m_riched;
-    public:
-        // document
-        CEDTextDocument&        doc;
-        // context
-        CellContext             ctx;
-        // metrics
-        CellMetrics             metrics;
+        // reserve for inserting text, may move this cell into bigger class, return null if failed
+        auto Reserve(uint32_t len) noexcept->CEDTextCell*;
     protected:
         // metainfo
         CellMeta                m_meta;
+        // cell class + 1, 0 if allocated from heap
+        uint16_t                m_pool;
+        // style id in document style table
+        uint16_t                m_style;
         // base string
         FixedStringA            m_string;
     };
-    // create a normal cell
-    auto CreateNormalCell(CEDTextDocument& doc, const RichData&)->CEDTextCell*;
+    // capacity of cell class
+    constexpr uint32_t GetCellClassCapacity(uint32_t index) noexcept {
+        return ((TEXT_CELL_STR_MINCAP + 1u) << index) <= TEXT_CELL_STR_MAXLEN
+            ? ((TEXT_CELL_STR_MINCAP + 1u) << index) - 1u : uint32_t(TEXT_CELL_STR_MAXLEN);
+    }
+    // cell class for length
+    constexpr uint32_t GetCellClass(uint32_t len) noexcept {
+        uint32_t index = 0;
+        while (index + 1 < TEXT_CELL_CLASS_COUNT && GetCellClassCapacity(index) < len) ++index;
+        return index;
+    }
+    // memory size of cell class
+    constexpr uint32_t GetCellClassSize(uint32_t index) noexcept {
+        return sizeof(CEDTextCell) + (GetCellClassCapacity(index) - 1) * sizeof(char16_t);
+    }
+    // create a normal cell, capacity >= len
+    auto CreateNormalCell(CEDTextDocument& doc, uint16_t style, uint32_t len = TEXT_CELL_STR_MAXLEN)->CEDTextCell*;
     // create a sharinked cell 
-    auto CreateShrinkedCell(CEDTextDocument& doc, const RichData&)->CEDTextCell*;
+    auto CreateShrinkedCell(CEDTextDocument& doc, uint16_t style)->CEDTextCell*;
+    // insert cell after node, into both list and cell index
+    void InsertCellAfter(Node& node, CEDTextCell& cell) noexcept;
 }
 
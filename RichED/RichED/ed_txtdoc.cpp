@@ -5,26 +5,17 @@
 #include "ed_txtdoc.h"
 #include "ed_txtplat.h"
 #include "ed_txtcell.h"
+#include "ed_txtbreak.h"
 
 #include <algorithm>
+#include <type_traits>
+#include <chrono>
 
 // debug via longui
 //#include <debugger/ui_debug.h>
 
 enum { RED_INIT_ARRAY_BUFLEN = 32 };
 
-// CJK LUT
-RED_LUT_ALIGNED const uint32_t RED_CJK_LUT[] = {
-    0x00000000, 0xfffc0000, 0xffffffff, 0xffffffff, 
-    0xffffffff, 0x00000000, 0x00000000, 0x06000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-    0xffffffff, 0xffffffff, 0xffffffff, 0x07000fff, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000,
-};
-
 // namesapce RichED::detail
 namespace RichED { namespace impl {
     // op record
@@ -102,7 +93,7 @@ namespace RichED { namespace impl {
             }
             ++itr;
         }
-        if (real_len && impl::is_1st_surrogate(itr[-1])) ++itr;
+        if (itr != rv.first && impl::is_1st_surrogate(itr[-1])) ++itr;
         rv.second = view.first = itr;
         return rv;
     }
@@ -115,18 +106,10 @@ namespace RichED { namespace impl {
             if (itr[-1] == '\n') break;
             --itr;
         }
-        if (real_len && impl::is_2nd_surrogate(itr[-1])) --itr;
+        if (itr != rv.second && itr != view.first && impl::is_2nd_surrogate(itr[0])) --itr;
         rv.first = view.second = itr;
         return rv;
     }
-    // is cjk
-    static uint32_t is_cjk(uint32_t ch) noexcept {
-        // 假定区域以0x100对齐
-        const uint32_t ch2 = (ch & 0x3ffff) >> 8;
-        const uint32_t index = ch2 >> 5;
-        const uint32_t mask = 1 << (ch2 & 0x1f);
-        return RED_CJK_LUT[index] & mask;
-    }
     // utf-32 to utf-16
     inline uint16_t utf32to16(char32_t ch, char16_t buffer[2]) {
         // utf32 -> utf32x2
@@ -139,6 +122,10 @@ namespace RichED { namespace impl {
         buffer[0] = static_cast<char16_t>(ch);
         return 1;
     }
+    // prefetch layout-hot data of cell: metrics.width ~ string.length
+    inline void prefetch_cell(const CEDTextCell* cell) noexcept {
+        RED_PREFETCH(&cell->metrics.width);
+    }
     // cell from node
     inline auto next_cell(Node* node) noexcept {
         return static_cast<CEDTextCell*>(node->next); }
@@ -148,6 +135,10 @@ namespace RichED { namespace impl {
     // cell from node
     inline auto next_cell(const Node* node) noexcept {
         return static_cast<const CEDTextCell*>(node->next); }
+    // grapheme breaker state after cell, inline object breaks both sides
+    inline uint8_t cell_leave(const CEDTextCell& cell) noexcept {
+        return cell.RefMetaInfo().metatype == Type_Normal
+            ? cell.clusters.leave : uint8_t(CEDGraphemeBreaker::STATE_SOT); }
     // itr
     template<typename T> struct nitr {
         // cell node
@@ -191,21 +182,89 @@ namespace RichED { namespace impl {
         vlv[size] = line;
         return true;
     }
+    // no-op mutex for serial layout
+    struct null_mutex {
+        void lock() noexcept {}
+        void unlock() noexcept {}
+    };
+    // split position from cached breaks[count, breaks...]: next visual line after vl_begin
+    inline uint32_t cached_wrap(const uint32_t* cache, uint32_t vl_begin, uint32_t cell_begin, uint32_t len) noexcept {
+        const auto end = cache + 1 + cache[0];
+        const auto itr = std::upper_bound(cache + 1, end, vl_begin);
+        // 后面没有断点: 行末; 断点在前: 整个CELL换行
+        if (itr == end) return len;
+        if (*itr <= cell_begin) return 0;
+        return std::min(*itr - cell_begin, len);
+    }
+    // word gap after cell: ends with space
+    inline bool gap_after(const CEDTextCell& cell) noexcept {
+        const auto& str = cell.RefString();
+        return str.length && str.data[str.length - 1] == ' ';
+    }
+    // size of wrap cache record
+    inline uint32_t wrap_record_size(const uint32_t* record) noexcept {
+        uint32_t size = 2 + record[1];
+        for (uint32_t i = 0; i != record[0]; ++i) size += 2 + record[size + 1];
+        return size;
+    }
+    // word count of break opportunity bitmap for line length, bit for each char
+    inline uint32_t break_words(uint32_t length) noexcept { return (length >> 5) + 1; }
+    // chunk of parallel layout
+    struct layout_chunk {
+        // visual lines of chunk
+        CEDBuffer<VisualLine>   lines;
+        // first visual line of next chunk
+        VisualLine              next;
+        // estimated width
+        unit_t                  width;
+        // ok
+        bool                    ok;
+    };
+    // parallel layout context
+    struct layout_parallel {
+        // document
+        CEDTextDocument*        doc;
+        // chunks
+        layout_chunk*           chunks;
+        // first logic line
+        uint32_t                first;
+        // logic line count per chunk
+        uint32_t                step;
+        // chunk count
+        uint32_t                count;
+        // next chunk to lay out
+        std::atomic<uint32_t>   next;
+        // mutex for cell list/index/pool
+        std::mutex              mutex;
+    };
     // txtoff
     struct txtoff_t { CEDTextCell* cell; uint32_t pos; };
     // find
     PCN_NOINLINE static auto find_cell1_txtoff(CEDTextCell* cell, uint32_t pos) noexcept {
-        // 遍历到合适的位置
-        while (pos > cell->RefString().length) {
+        // 遍历到合适的位置: 近处直接遍历
+        for (uint32_t i = 0; i != CELL_INDEX_WALK; ++i) {
+            if (pos <= cell->RefString().length) {
+                const txtoff_t rv = { cell, pos };
+                return rv;
+            }
             assert(cell->RefMetaInfo().eol == false);
             pos -= cell->RefString().length;
             cell = impl::next_cell(cell);
         }
-        const txtoff_t rv = { cell, pos };
+        // 远处(超长行)利用索引: 这之前的CELL结束位置均小于目标位置
+        auto& index = cell->doc.RefCellIndex();
+        txtoff_t rv = { cell, pos };
+        rv.cell = index.Find(index.Prefix(*cell) + pos, rv.pos);
+        assert(rv.cell && "out of range");
         return rv;
     }
     // find
     PCN_NOINLINE static auto find_cell2_txtoff(CEDTextCell* cell, uint32_t pos) noexcept {
+        // 先定位至结束位置不小于目标的CELL, 之后最多越过其末尾
+        if (pos) {
+            const auto val = find_cell1_txtoff(cell, pos);
+            cell = val.cell; pos = val.pos;
+        }
         // 遍历到合适的位置
         while (pos >= cell->RefString().length) {
             if (cell->RefMetaInfo().eol) break;
@@ -257,7 +316,7 @@ namespace RichED { namespace impl {
     // init rich for set as
     void rich_init(void* ptr, bool relayout, uint16_t o, uint16_t l, const RichSingeOp& a) noexcept;
     // rich undoredo
-    void rich_set(void*, uint32_t, const RichData&, DocPoint, DocPoint) noexcept;
+    void rich_set(void*, uint32_t, uint16_t style, DocPoint, DocPoint) noexcept;
 
 
     // text undoredo
@@ -293,7 +352,7 @@ namespace RichED { namespace impl {
     // insert ruby
     void ruby_as_insert(void* ptr, uint16_t id) noexcept;
     // ruby set data
-    void ruby_set_data(void* ptr, DocPoint, char32_t, U16View, const RichData&) noexcept;
+    void ruby_set_data(void* ptr, DocPoint, char32_t, U16View, uint16_t style) noexcept;
 }}
 
 
@@ -302,7 +361,7 @@ namespace RichED {
     // create cell
     auto CreatePublicCell(
         CEDTextDocument& doc,
-        const RichData& red,
+        uint16_t style,
         uint32_t exlen,
         uint32_t capacity
     ) noexcept->CEDTextCell*;
@@ -329,7 +388,7 @@ namespace RichED {
     // hittest
     struct HitTestCtx {
         // visual line
-        const VisualLine*   visual_line;
+        VisualLine*         visual_line;
         // text cell
         CEDTextCell*        text_cell;
         // pos: before cell
@@ -366,10 +425,55 @@ namespace RichED {
         static bool RichRange(const CheckRangeCtx&, CellPoint out[2]) noexcept;
         // check range
         static bool CheckRange(CEDTextDocument& doc, DocPoint begin, DocPoint& end, CheckRangeCtx& ctx) noexcept;
-        // check wrap mode
-        static auto CheckWrap(CEDTextDocument& doc, CEDTextCell& cell, unit_t pos) noexcept->CEDTextCell*;
+        // check wrap mode, bits: break opportunities of logic line, split >= min
+        static auto CheckWrap(CEDTextDocument& doc, CEDTextCell& cell, unit_t pos, const uint32_t* bits, uint32_t begin, uint32_t min) noexcept->uint32_t;
+        // find break opportunities of logic line in wrap cache
+        static auto FindBreak(const CEDTextDocument& doc, uint32_t lineno) noexcept->const uint32_t*;
+        // compute break opportunities of logic line from first cell
+        static void LineBreaks(const CEDTextDocument& doc, const CEDTextCell& first, uint32_t words, uint32_t* bits) noexcept;
+        // find wrap cache of logic line for viewport width, [count, breaks...]
+        static auto FindWrap(const CEDTextDocument& doc, uint32_t lineno) noexcept->const uint32_t*;
+        // save wrap cache of logic line: break opportunities[null to keep] and breaks for viewport width
+        static void SaveWrap(CEDTextDocument& doc, uint32_t lineno, const uint32_t* bits, const uint32_t* breaks, uint32_t count) noexcept;
+        // reserve space in wrap cache, compact if full
+        static bool ReserveWrap(CEDTextDocument& doc, uint32_t len) noexcept;
+        // clear wrap cache
+        static void ClearWrap(CEDTextDocument& doc) noexcept;
         // expand visual line clean area
         static void ExpandVL(CEDTextDocument& doc, uint32_t ll, unit_t) noexcept;
+        // skip lines before ll or above top as estimated visual lines
+        static void SkipVL(CEDTextDocument& doc, uint32_t ll, unit_t top) noexcept;
+        // scale laid-out lines to estimated visual lines for new viewport width
+        static void ScaleVL(CEDTextDocument& doc, unit_t old_width) noexcept;
+        // lay out estimated visual lines of logic lines [begin, end)
+        static bool FillVL(CEDTextDocument& doc, uint32_t begin, uint32_t end) noexcept;
+        // lay out estimated visual lines of logic lines [begin, end) in place, no clean tail
+        static bool RefineVL(CEDTextDocument& doc, uint32_t begin, uint32_t end) noexcept;
+        // lay out estimated visual lines in viewport
+        static bool FillViewVL(CEDTextDocument& doc) noexcept;
+        // apply text align to cells of laid-out visual line if out of date
+        static void AlignVL(CEDTextDocument& doc, VisualLine& vl) noexcept;
+        // apply text align to visual lines in viewport
+        static void AlignViewVL(CEDTextDocument& doc) noexcept;
+        // bits of VisualLine::aligned
+        enum : uint32_t { ALIGN_GEN_MASK = 0x7fffffff };
+        // text align of all visual lines out of date, generation 0 reserved for leading pos from layout
+        static void Realign(CEDTextDocument& doc) noexcept { doc.m_uAlignGen = (doc.m_uAlignGen + 1) & ALIGN_GEN_MASK; if (!doc.m_uAlignGen) doc.m_uAlignGen = 1; NeedRedraw(doc); }
+        // truncate visual lines at first estimated one, keep rest as clean tail
+        static bool GapVL(CEDTextDocument& doc) noexcept;
+        // background layout step
+        static bool LayoutStep(void* ctx) noexcept;
+        // lay out rest lines step by step until budget[us] used up, return true if progressed
+        static bool BudgetVL(CEDTextDocument& doc, std::chrono::steady_clock::time_point deadline) noexcept;
+        // lay out visual lines in viewport, refresh caret and selection if lines above changed
+        static void ViewVL(CEDTextDocument& doc, bool refresh) noexcept;
+        // lay out all rest lines in parallel
+        static void ParallelVL(CEDTextDocument& doc, uint32_t thread_count) noexcept;
+        // parallel layout step
+        static bool ParallelStep(void* ctx) noexcept;
+        // lay out one logic line from line.first, then line = first visual line of next logic line
+        template<typename T, typename M>
+        static bool WrapLine(CEDTextDocument& doc, VisualLine& line, unit_t& width, T push, M& mutex) noexcept;
         // recreate cell
         static void Recreate(CEDTextDocument&doc, CEDTextCell& cell) noexcept;
         // set selection
@@ -389,13 +493,42 @@ namespace RichED {
         // record obj for ins
         static void RecrodObjsEx(CEDTextDocument& doc, DocPoint begin, CEDTextCell& cell) noexcept;
         // record ruby for ins
-        static void RecordRubyEx(CEDTextDocument& doc, DocPoint begin, const RichData&, char32_t, U16View)noexcept;
+        static void RecordRubyEx(CEDTextDocument& doc, DocPoint begin, uint16_t style, char32_t, U16View)noexcept;
         // record text for ins
         static void RecordTextEx(CEDTextDocument& doc, DocPoint begin, DocPoint end, U16View)noexcept;
         // mark dirty
-        static void Dirty(CEDTextDocument& doc, CEDTextCell& cell, uint32_t logic_line)noexcept;
+        static void Dirty(CEDTextDocument& doc, uint32_t logic_line, uint32_t line_count = 1)noexcept;
+        // mark dirty the end logic lines of style range whose cell was split, others redrawn only
+        static void DirtySplit(CEDTextDocument& doc, uint32_t first, uint32_t last, bool split_first, bool split_last) noexcept;
+        // logic lines inserted[delta > 0] or removed[delta < 0] at line
+        static void ShiftVL(CEDTextDocument& doc, uint32_t line, int32_t delta)noexcept;
+        // push visual line
+        static bool PushVL(CEDTextDocument& doc, const VisualLine& line)noexcept;
+        // splice clean visual lines after the line
+        static bool SpliceVL(CEDTextDocument& doc, const VisualLine& line)noexcept;
+        // reset visual lines
+        static void ResetVL(CEDTextDocument& doc) noexcept { doc.m_vVisual.ReduceSize(1); doc.m_uTailBegin = doc.m_uTailEnd = 0; }
+        // fixed line height mode
+        static bool IsFixedLH(const CEDTextDocument& doc) noexcept { return !!(doc.m_info.flags & Flag_FixedLineHeight); }
+        // height of visual line
+        static auto HeightVL(const CEDTextDocument& doc, const VisualLine& vl) noexcept {
+            return IsFixedLH(doc) ? doc.m_info.fixed_lineheight : vl.ar_height_max + vl.dr_height_max; }
+        // offset of visual line
+        static auto OffsetVL(const CEDTextDocument& doc, uint32_t index) noexcept {
+            return IsFixedLH(doc) ? times(doc.m_info.fixed_lineheight, index) : doc.m_height.Prefix(index); }
+        // offset of visual line
+        static auto OffsetVL(const CEDTextDocument& doc, const VisualLine& vl) noexcept {
+            return OffsetVL(doc, uint32_t(&vl - doc.m_vVisual.begin())); }
+        // max count of visual lines that offset <= y, y >= 0
+        static auto FindVL(const CEDTextDocument& doc, unit_t y) noexcept ->uint32_t;
+        // estimate height of document: measured laid-out lines + estimated rest
+        static void EstimateVL(CEDTextDocument& doc) noexcept;
+        // guess height of logic line: line_h + char_h x length
+        static void GuessVL(const CEDTextDocument& doc, unit_t& line_h, unit_t& char_h) noexcept;
         // merge cells
         static bool Merge(CEDTextDocument& doc, CEDTextCell& cell, unit_t, unit_t) noexcept;
+        // grapheme clusters of cell in logic line begin with first
+        static auto Clusters(CEDTextCell& first, CEDTextCell& cell) noexcept->const uint32_t*;
         // logic left move
         static auto LogicLeft(CEDTextDocument& doc, DocPoint) noexcept ->DocPoint;
         // logic right move
@@ -414,15 +547,15 @@ namespace RichED {
         static void ValueChanged(CEDTextDocument& doc, uint32_t flag) noexcept { doc.m_flagChanged |= flag; }
         // need redraw
         static void NeedRedraw(CEDTextDocument& doc) noexcept { ValueChanged(doc, Changed_View); }
+        // style id of default riched, TEXT_STYLE_INVALID if failed
+        static auto DefaultStyle(CEDTextDocument& doc) noexcept { return doc.InternStyle(doc.default_riched); }
         // check estimated
         static void CheckEstimated(CEDTextDocument& doc) noexcept;
+        // release all cells
+        static void ReleaseCells(CEDTextDocument& doc) noexcept;
+        // compact style table with styles of living cells, undo history dropped
+        static bool CompactStyle(CEDTextDocument& doc) noexcept;
     };
-    // RichData ==
-    inline bool operator==(const RichData& a, const RichData& b) noexcept {
-        return !std::memcmp(&a, &b, sizeof(a)); }
-    // RichData !==
-    inline bool operator!=(const RichData& a, const RichData& b) noexcept {
-        return !(a == b); }
     // cmp
     inline auto Cmp(DocPoint dp) noexcept {
         uint64_t u64;
@@ -475,7 +608,10 @@ bool RichED::CEDTextDocument::Private::IsRecord(
 /// <param name="plat">The plat.</param>
 /// <param name="arg">The argument.</param>
 RichED::CEDTextDocument::CEDTextDocument(IEDTextPlatform& plat, const DocInitArg& arg) noexcept
-: platform(plat) {
+: platform(plat), m_pools{
+    { GetCellClassSize(0) }, { GetCellClassSize(1) },
+    { GetCellClassSize(2) }, { GetCellClassSize(3) } } {
+    static_assert(TEXT_CELL_CLASS_COUNT == 4, "update m_pools");
     // 计算
     auto cal_password = [](char32_t ch) noexcept {
         union { char32_t u32; char16_t u16[2]; };
@@ -513,8 +649,13 @@ RichED::CEDTextDocument::CEDTextDocument(IEDTextPlatform& plat, const DocInitArg
     m_info.flags            = arg.flags;
     m_info.password_cha16x2 = cal_password(arg.password);
     m_info.fixed_lineheight = arg.fixed_lineheight;
+    // 固定行高必须为正
+    if (!(m_info.fixed_lineheight > 0))
+        m_info.flags = DocFlag(m_info.flags & ~Flag_FixedLineHeight);
+    else if (m_info.flags & Flag_FixedLineHeight)
+        m_rcCaret.height = m_info.fixed_lineheight;
     m_info.valign           = arg.valign;
-    //m_info.talign           = arg.talign;
+    m_info.talign           = arg.talign;
     m_info.wrap_mode        = arg.wrap_mode;
     m_bPassword4 = arg.password > 0xFFFF;
 #ifndef NDEBUG
@@ -526,10 +667,12 @@ RichED::CEDTextDocument::CEDTextDocument(IEDTextPlatform& plat, const DocInitArg
         assert(!(arg.flags & Flag_RichText) && "rich password?");
     }
 #endif
-    // 初始CELL
-    const auto cell = RichED::CreateNormalCell(*this, arg.riched);
+    // 初始CELL, 默认格式作为0号样式
+    const auto style = this->InternStyle(arg.riched);
+    const auto cell = style == TEXT_STYLE_INVALID ? nullptr
+        : RichED::CreateNormalCell(*this, style, 0);
     // 缓存
-    m_vLogic.Resize(RED_INIT_ARRAY_BUFLEN, plat);
+    m_vLogic.Reserve(RED_INIT_ARRAY_BUFLEN, plat);
     m_vVisual.Resize(RED_INIT_ARRAY_BUFLEN, plat);
     if (m_vVisual.IsFailed() | m_vLogic.IsFailed() | !cell) {
         arg.code = DocInitArg::CODE_OOM;
@@ -537,12 +680,11 @@ RichED::CEDTextDocument::CEDTextDocument(IEDTextPlatform& plat, const DocInitArg
     }
     // 第一行数据
     cell->AsEOL();
-    RichED::InsertAfterFirst(m_head, *cell);
-    m_vLogic.Resize(1, plat);
-    m_vLogic[0] = { cell, 0 };
+    RichED::InsertCellAfter(m_head, *cell);
+    m_vLogic.Insert(0, 1, plat)[0] = { cell, 0, 0 };
     m_vVisual.Resize(1, plat);
     //m_vVisual[0] = { static_cast<CEDTextCell*>(&m_head), uint32_t(-1) };
-    m_vVisual[0] = { cell, 0 };
+    m_vVisual[0] = { cell, 0, 0, 0, 0, 0, 0, 0 };
     // TODO: OOM 后 再调用时m_vLogic/m_vLogic判断?
 }
 
@@ -551,34 +693,103 @@ RichED::CEDTextDocument::CEDTextDocument(IEDTextPlatform& plat, const DocInitArg
 /// </summary>
 /// <returns></returns>
 RichED::CEDTextDocument::~CEDTextDocument() noexcept {
-    // 释放CELL链
-    auto cell = impl::next_cell(&m_head);
-    while (cell != &m_tail) {
+    m_worker.Pause();
+    Private::ReleaseCells(*this);
+}
+
+/// <summary>
+/// Releases all cells.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ReleaseCells(CEDTextDocument& doc) noexcept {
+    // 释放CELL链: 池中的CELL只需释放上下文, 池由调用方整块释放
+    auto cell = impl::next_cell(&doc.m_head);
+    while (cell != &doc.m_tail) {
         const auto node = cell;
         cell = impl::next_cell(cell);
-        node->Dispose();
+        if (node->IsPooled()) node->Sleep();
+        else node->Dispose();
     }
-    m_head.next = &m_tail;
-    m_tail.prev = &m_head;
+    doc.m_head.next = &doc.m_tail;
+    doc.m_tail.prev = &doc.m_head;
+    doc.m_index.Build(doc.m_head, doc.m_tail);
+}
+
+/// <summary>
+/// Compacts the style table.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns>false if oom, style table unchanged</returns>
+bool RichED::CEDTextDocument::Private::CompactStyle(CEDTextDocument& doc) noexcept {
+    // 样式只追加, 仅在没有外部引用的时机按存活CELL与撤销记录重建
+    const uint32_t count = doc.m_styles.GetCount();
+    const auto map = static_cast<uint16_t*>(doc.Alloc(sizeof(uint16_t) * (count + 1)));
+    if (!map) return false;
+    std::memset(map, 0xff, sizeof(uint16_t) * count);
+    CEDStyleTable table;
+    struct compact_ctx { CEDTextDocument& doc; CEDStyleTable& table; uint16_t* map; uint32_t count; bool ok; };
+    compact_ctx ctx = { doc, table, map, count, true };
+    const auto intern = [](void* ptr, uint16_t& style) noexcept {
+        auto& c = *static_cast<compact_ctx*>(ptr);
+        if (!c.ok || style >= c.count) return;
+        auto& id = c.map[style];
+        if (id != TEXT_STYLE_INVALID) return;
+        id = c.table.Intern(c.doc.RefStyle(style), c.doc);
+        if (id == TEXT_STYLE_INVALID) c.ok = false;
+    };
+    const auto remap = [](void* ptr, uint16_t& style) noexcept {
+        const auto& c = *static_cast<compact_ctx*>(ptr);
+        if (style < c.count) style = c.map[style];
+    };
+    // 第一次遍历: 建立映射, 失败的话旧表保持不变
+    while (true) {
+        for (auto cell = impl::next_cell(&doc.m_head); cell != &doc.m_tail && ctx.ok; cell = impl::next_cell(cell)) {
+            auto style = cell->GetStyle();
+            intern(&ctx, style);
+        }
+        if (ctx.ok) doc.m_undo.VisitStyle(&ctx, intern);
+        // 撤销记录占用过多样式时舍弃较旧的一半再来
+        if (!ctx.ok || table.GetCount() < TEXT_STYLE_COMPACT_COUNT / 2) break;
+        if (!doc.m_undo.DropOlder()) break;
+        Private::ValueChanged(doc, Changed_UndoDropped);
+        std::memset(map, 0xff, sizeof(uint16_t) * count);
+        table.ReleaseAll();
+    }
+    // 第二次遍历: 重新映射, 样式数据不变, 无需重新布局; 撤销记录一并保留
+    if (ctx.ok) {
+        for (auto cell = impl::next_cell(&doc.m_head); cell != &doc.m_tail; cell = impl::next_cell(cell))
+            cell->RemapStyle(map[cell->GetStyle()]);
+        doc.m_undo.VisitStyle(&ctx, remap);
+        doc.m_styles.Swap(table);
+    }
+    RichED::Free(map);
+    return ctx.ok;
 }
 
 /// <summary>
 /// Updates this instance.
 /// </summary>
+/// <param name="budget_us">The budget[us] of laying out rest lines, 0 for none.</param>
 /// <returns></returns>
-auto RichED::CEDTextDocument::Update() noexcept -> ValuedChanged {
+auto RichED::CEDTextDocument::Update(uint32_t budget_us) noexcept -> ValuedChanged {
+    this->EndLayoutAsync();
+    // 预算包括视口内的布局
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(budget_us);
     // 调整宽度可能会导致插入符移动
-    if ((m_flagChanged & Changed_ViewportWidth) && m_info.wrap_mode) {
-        // 调整
-        Private::RefreshCaret(*this, m_dpCaret, nullptr);
+    const bool resized = !!(m_flagChanged & Changed_ViewportWidth);
+    const bool rewrap = resized && m_info.wrap_mode;
+    if (rewrap) {
+        // 旧布局缩放为估计行, 只有视口内的行重新布局
+        Private::ScaleVL(*this, m_fLayoutWidth);
+        m_fLayoutWidth = m_rcViewport.width;
+        m_flagChanged |= Changed_View;
     }
+    // 非起始对齐的行内偏移依赖视口宽度
+    if (resized && m_info.talign) Private::Realign(*this);
     // 重绘
     if (m_flagChanged & Changed_View) {
-        const auto bottom = m_rcViewport.y + m_rcViewport.height;
-        const auto maxbtm = max_unit();
-        Private::ExpandVL(*this, uint32_t(-1), bottom);
-        Private::CheckEstimated(*this);
-        m_szEstimatedCmp = m_szEstimated;
+        Private::ViewVL(*this, resized);
 #ifndef NDEBUG
         if (m_bUpdateDbg) {
             this->platform.DebugOutput("view update more than once before rendering.", true);
@@ -587,6 +798,9 @@ auto RichED::CEDTextDocument::Update() noexcept -> ValuedChanged {
         this->platform.DebugOutput("<BeforeRender>", false);
 #endif // !NDEBUG
     }
+    // 视口之外的行在剩余预算内布局, 视口内的行可能因此移动
+    if (budget_us && Private::BudgetVL(*this, deadline))
+        Private::ViewVL(*this, true);
     // 返回
     const auto rv = m_flagChanged;
     m_flagChanged = 0;
@@ -598,26 +812,25 @@ auto RichED::CEDTextDocument::Update() noexcept -> ValuedChanged {
 /// </summary>
 /// <returns></returns>
 void RichED::CEDTextDocument::Render(CtxPtr ctx) noexcept {
+    this->EndLayoutAsync();
 #ifndef NDEBUG
     m_bUpdateDbg = false;
 #endif
     const auto count = m_vVisual.GetSize();
     if (!count) return;
-    // TODO: 固定行高
     const auto data = m_vVisual.GetData();
     const auto end_line = data + count - 1;
-    // 计算起点
-    auto this_line = data;
     // l 逻辑/布局 ltrb 左上右下
     const auto view_lt = m_rcViewport.y;
     const auto view_lb = m_rcViewport.y + m_rcViewport.height;
     const auto view_ll = m_rcViewport.x;
     const auto view_lr = m_rcViewport.x + m_rcViewport.width;
-    while (this_line != end_line) {
-        const auto next_line = this_line + 1;
-        if (next_line->offset >= view_lt) break;
-        this_line = next_line;
-    }
+    // 计算起点: 固定行高直接计算, 否则利用高度索引找到视口顶部所在行
+    const auto index = std::min(Private::FindVL(*this, std::max(view_lt, unit_t(0))), count - 1);
+    auto this_line = data + index;
+    auto this_offset = Private::OffsetVL(*this, index);
+    const auto fixed = Private::IsFixedLH(*this);
+    const auto fixed_lh = m_info.fixed_lineheight;
     // 计算右边
     const auto cal_layout_right = [](CEDTextCell& cell) noexcept {
         return cell.metrics.bounding.right + cell.metrics.pos + cell.metrics.offset.x;
@@ -636,14 +849,18 @@ void RichED::CEDTextDocument::Render(CtxPtr ctx) noexcept {
         }(this_line->first);
         // 获取循环表
         const auto cells = impl::cfor_cells(start_point, next_line->first);
-        const auto baseline = this_line->offset + this_line->ar_height_max;
+        // 固定行高: 上下平分行距
+        const auto content_h = this_line->ar_height_max + this_line->dr_height_max;
+        const auto leading = fixed ? half(fixed_lh - content_h) : unit_t(0);
+        const auto baseline = this_offset + leading + this_line->ar_height_max;
         for (auto& cell : cells) {
             this->platform.DrawContext(ctx, cell, baseline);
             // 超过就退出
             if (cal_layout_right(cell) >= view_lr 
                 && cell.RefMetaInfo().metatype != Type_UnderRuby) break;
         }
-        if (next_line->offset >= view_lb) break;
+        this_offset += fixed ? fixed_lh : content_h;
+        if (this_offset >= view_lb) break;
         this_line = next_line;
     }
 }
@@ -655,6 +872,7 @@ void RichED::CEDTextDocument::Render(CtxPtr ctx) noexcept {
 /// <param name="pos">The position.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::MoveViewportAbs(Point pos) noexcept {
+    this->EndLayoutAsync();
     Point target_view;
     // 垂直布局
     if (m_matrix.read_direction & 1) {
@@ -676,6 +894,7 @@ void RichED::CEDTextDocument::MoveViewportAbs(Point pos) noexcept {
 /// <param name="pos">The position.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::MoveViewportRel(Point pos) noexcept {
+    this->EndLayoutAsync();
     Point target_view{ m_rcViewport.x, m_rcViewport.y };
     // 垂直布局
     if (m_matrix.read_direction & 1) {
@@ -701,6 +920,7 @@ void RichED::CEDTextDocument::MoveViewportRel(Point pos) noexcept {
 /// <returns></returns>
 auto RichED::CEDTextDocument::InsertText(
     DocPoint dp, U16View view, bool behind) noexcept -> DocPoint {
+    this->EndLayoutAsync();
     if (dp.line < m_vLogic.GetSize()) {
         const auto line_data = m_vLogic[dp.line];
         dp.pos = std::min(dp.pos, line_data.length);
@@ -735,6 +955,7 @@ auto RichED::CEDTextDocument::InsertText(
 /// <param name="view">The view.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::InsertRuby(DocPoint dp, char32_t ch, U16View view, const RichData* rich_ptr) noexcept {
+    this->EndLayoutAsync();
     assert(ch && "bad char");
     if (dp.line < m_vLogic.GetSize()) {
         // 不能包含换行信息
@@ -743,14 +964,19 @@ bool RichED::CEDTextDocument::InsertRuby(DocPoint dp, char32_t ch, U16View view,
         auto& line_data = m_vLogic[dp.line];
         dp.pos = std::min(dp.pos, line_data.length);
         auto riched = rich_ptr ? *rich_ptr : default_riched; 
+        const auto style = this->InternStyle(riched);
+        const auto default_style = Private::DefaultStyle(*this);
+        riched.size = half(riched.size);
+        const auto ruby_style = this->InternStyle(riched);
+        if ((style == TEXT_STYLE_INVALID) | (default_style == TEXT_STYLE_INVALID)
+            | (ruby_style == TEXT_STYLE_INVALID)) return false;
         // 处理存在撤销栈的情况
         if (Private::IsRecord(*this)) {
             // 记录文本
-            Private::RecordRubyEx(*this, dp, riched, ch, real_view);
+            Private::RecordRubyEx(*this, dp, style, ch, real_view);
         }
         // 创建一个简单的
-        riched.size = half(riched.size);
-        const auto cell = RichED::CreateShrinkedCell(*this, riched);;
+        const auto cell = RichED::CreateShrinkedCell(*this, ruby_style);;
         if (!cell) return false;
         const_cast<CellMeta&>(cell->RefMetaInfo()).metatype = Type_UnderRuby;
         auto& str = const_cast<FixedStringA&>(cell->RefString());
@@ -760,7 +986,7 @@ bool RichED::CEDTextDocument::InsertRuby(DocPoint dp, char32_t ch, U16View view,
         // 插入普通数据
         dp.pos += cell->RefString().length;
         const auto rv = Private::Insert(*this, dp, real_view, line_data, false);
-        cell->SetRichED(default_riched);
+        cell->SetStyle(default_style);
         return rv;
     }
     assert(!"OUT OF RANGE");
@@ -775,6 +1001,7 @@ bool RichED::CEDTextDocument::InsertRuby(DocPoint dp, char32_t ch, U16View view,
 /// <returns></returns>
 void RichED::CEDTextDocument::SetAnchorCaret(
     DocPoint anchor, DocPoint caret) noexcept {
+    this->EndLayoutAsync();
     m_dpAnchor = anchor;
     Private::SetSelection(*this, nullptr, caret, impl::mode_target, true);
     Private::RefreshCaret(*this, m_dpCaret, nullptr);
@@ -795,6 +1022,7 @@ void RichED::CEDTextDocument::SetAnchorCaret(
 /// <param name="len">The length.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::RankUpMagic(DocPoint dp, uint32_t len) noexcept {
+    this->EndLayoutAsync();
     // 行检测
     if (dp.line >= m_vLogic.GetSize()) return assert(!"OUT OF RANGE");
     const auto data = m_vLogic[dp.line];
@@ -804,7 +1032,7 @@ void RichED::CEDTextDocument::RankUpMagic(DocPoint dp, uint32_t len) noexcept {
     auto cell = data.first;
     auto pos = dp.pos;
     impl::find_cell2_txtoff_ex(cell, pos);
-    Private::Dirty(*this, *cell, dp.line);
+    Private::Dirty(*this, dp.line);
     assert(pos < cell->RefString().length);
     // 单字
     uint32_t end_pos = pos + 1;
@@ -842,6 +1070,7 @@ void RichED::CEDTextDocument::RankUpMagic(DocPoint dp, uint32_t len) noexcept {
 /// <returns></returns>
 void RichED::CEDTextDocument::RankUpMagic(
     DocPoint dp, const InlineInfo& info, int16_t len, CellType type) noexcept {
+    this->EndLayoutAsync();
     if (dp.line < m_vLogic.GetSize()) {
         auto& data = m_vLogic[dp.line];
         if (dp.pos < data.length) {
@@ -850,7 +1079,7 @@ void RichED::CEDTextDocument::RankUpMagic(
             auto cell = data.first;
             auto pos = dp.pos;
             impl::find_cell2_txtoff_ex(cell, pos);
-            Private::Dirty(*this, *cell, dp.line);
+            Private::Dirty(*this, dp.line);
             assert(pos < cell->RefString().length);
             // 分离对象
             if (!cell->Split(pos + 1)) return;
@@ -859,7 +1088,7 @@ void RichED::CEDTextDocument::RankUpMagic(
             if (!obj) return;
             // EOL信息
             cell->MoveEOL(*obj);
-            RichED::InsertAfterFirst(*cell, *obj);
+            RichED::InsertCellAfter(*cell, *obj);
             cell->RemoveTextEx({ pos , 1 });
             // 防止失效
             data.first = impl::next_cell(next_is_first);
@@ -880,7 +1109,9 @@ auto RichED::CEDTextDocument::Private::CreateInline(
     CEDTextDocument& doc,
     const InlineInfo &info, int16_t len, CellType type) noexcept -> CEDTextCell * {
     assert(len >= 0);
-    const auto ptr = RichED::CreatePublicCell(doc, doc.default_riched, len, 1);
+    const auto style = Private::DefaultStyle(doc);
+    if (style == TEXT_STYLE_INVALID) return nullptr;
+    const auto ptr = RichED::CreatePublicCell(doc, style, len, 1);
     if (ptr) {
         const_cast<CellType&>(ptr->RefMetaInfo().metatype) = type;
         std::memcpy(ptr->GetExtraInfo(), &info, len);
@@ -901,6 +1132,7 @@ auto RichED::CEDTextDocument::Private::CreateInline(
 /// <returns></returns>
 bool RichED::CEDTextDocument::InsertInline(DocPoint dp, 
     const InlineInfo &info, int16_t len, CellType type) noexcept {
+    this->EndLayoutAsync();
     const auto cell = Private::CreateInline(*this, info, len, type);
     if (!cell) return false;
     // 正式处理
@@ -929,6 +1161,7 @@ bool RichED::CEDTextDocument::InsertInline(DocPoint dp,
 /// <param name="end">The end.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::RemoveText(DocPoint begin, DocPoint end) noexcept {
+    this->EndLayoutAsync();
     CheckRangeCtx ctx;
     if (!Private::CheckRange(*this, begin, end, ctx)) return false;
     // 处理存在撤销栈的情况
@@ -947,12 +1180,118 @@ bool RichED::CEDTextDocument::RemoveText(DocPoint begin, DocPoint end) noexcept
     return Private::RemoveText(*this, begin, end, ctx);
 }
 
+/// <summary>
+/// Assigns the whole text.
+/// </summary>
+/// <param name="view">The view.</param>
+/// <returns>false if OOM, document unchanged</returns>
+bool RichED::CEDTextDocument::Assign(U16View view) noexcept {
+    // 后台布局持有整个文档
+    this->EndLayoutAsync();
+    const auto style = Private::DefaultStyle(*this);
+    if (style == TEXT_STYLE_INVALID) return false;
+    // 第一次遍历: 统计行数以及各类别CELL数量
+    uint32_t line_count = 0;
+    uint32_t cell_count[TEXT_CELL_CLASS_COUNT] = { 0 };
+    for (auto v = view; ; ) {
+        const auto line = impl::lfview(v);
+        const auto len = static_cast<uint32_t>(line.second - line.first);
+        cell_count[RichED::GetCellClass(TEXT_CELL_STR_MAXLEN)] += len / TEXT_CELL_STR_MAXLEN;
+        ++cell_count[RichED::GetCellClass(len % TEXT_CELL_STR_MAXLEN)];
+        ++line_count;
+        if (v.first == v.second) {
+            // 最后一个换行
+            if (v.first != view.first && v.first[-1] == '\n') {
+                ++cell_count[0]; ++line_count;
+            }
+            break;
+        }
+    }
+    // 新的逻辑行与CELL先建立在旧数据旁边, 内存不足时旧文档保持不变
+    CEDGapBuffer<LogicLine> logic;
+    if (!logic.Reserve(line_count, this->platform)) return false;
+    const auto lines = logic.Insert(0, line_count, this->platform);
+    assert(lines && "reserved");
+    // 旧的整块换出, CELL从新的整块中连续申请, 失败的话后面逐个申请
+    CEDCellPool pools[TEXT_CELL_CLASS_COUNT] = {
+        { GetCellClassSize(0) }, { GetCellClassSize(1) },
+        { GetCellClassSize(2) }, { GetCellClassSize(3) } };
+    for (uint32_t i = 0; i != TEXT_CELL_CLASS_COUNT; ++i) {
+        m_pools[i].Swap(pools[i]);
+        if (cell_count[i]) m_pools[i].Reserve(*this, cell_count[i]);
+    }
+    // 第二次遍历: 直接链接, 最后统一建立索引
+    Node head = { nullptr, nullptr };
+    Node* last = &head;
+    uint32_t line_done = 0;
+    uint32_t total_length = 0;
+    for (auto v = view; line_done != line_count; ++line_done) {
+        auto line = impl::lfview(v);
+        const auto len = static_cast<uint32_t>(line.second - line.first);
+        CEDTextCell* first = nullptr;
+        CEDTextCell* cell = nullptr;
+        do {
+            // 将有效字符串拆分成最大长度的字符串块
+            auto this_end = line.first + TEXT_CELL_STR_MAXLEN;
+            // 越界
+            if (this_end > line.second) this_end = line.second;
+            // 双字检查
+            if (this_end != line.first && impl::is_1st_surrogate(this_end[-1])) ++this_end;
+            const auto obj = RichED::CreateNormalCell(*this, style,
+                static_cast<uint32_t>(this_end - line.first));
+            if (!obj) break;
+            obj->InsertText(0, { line.first, this_end });
+            obj->prev = last;
+            last->next = obj;
+            last = cell = obj;
+            if (!first) first = obj;
+            line.first = this_end;
+        } while (line.first < line.second);
+        if (line.first < line.second || !cell) break;
+        cell->AsEOL();
+        lines[line_done] = { first, len, 0 };
+        total_length += len;
+    }
+    // 内存不足: 释放新的CELL, 换回旧的整块
+    if (line_done != line_count) {
+        last->next = nullptr;
+        for (auto node = head.next; node; ) {
+            const auto next = node->next;
+            static_cast<CEDTextCell*>(node)->Dispose();
+            node = next;
+        }
+        for (uint32_t i = 0; i != TEXT_CELL_CLASS_COUNT; ++i) m_pools[i].Swap(pools[i]);
+        return false;
+    }
+    // 释放旧的数据, 不再记录撤销; 旧的整块随pools析构释放
+    m_undo.Clear();
+    Private::ReleaseCells(*this);
+    m_vLogic.Swap(logic);
+    m_info.total_length = total_length;
+    head.next->prev = &m_head;
+    m_head.next = head.next;
+    last->next = &m_tail;
+    m_tail.prev = last;
+    m_index.Build(m_head, m_tail);
+    // 旧的CELL与撤销记录都已释放, 顺便压缩样式表
+    Private::CompactStyle(*this);
+    m_vWrap.Clear();
+    // 视觉行与插入符重置
+    Private::ResetVL(*this);
+    m_vVisual[0] = { m_vLogic[0].first, 0, 0, 0, 0, 0, 0, 0 };
+    Private::ValueChanged(*this, Changed_Text);
+    Private::NeedRedraw(*this);
+    this->SetAnchorCaret({ 0, 0 }, { 0, 0 });
+    return true;
+}
+
 /// <summary>
 /// Resizes the specified size.
 /// </summary>
 /// <param name="size">The size.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::ResizeViewport(Size size) noexcept {
+    this->EndLayoutAsync();
     uint32_t flag = 0;
     // 垂直布局
     if (m_matrix.read_direction & 1) {
@@ -989,6 +1328,51 @@ void RichED::CEDTextDocument::Private::ViewPoint(
 }
 
 
+/// <summary>
+/// Gets the memory statistics.
+/// </summary>
+/// <returns></returns>
+auto RichED::CEDTextDocument::GetMemoryStats() noexcept -> DocMemoryStats {
+    this->EndLayoutAsync();
+    DocMemoryStats stats = {};
+    // 遍历CELL
+    for (auto node = m_head.next; node != &m_tail; node = node->next) {
+        const auto cell = static_cast<const CEDTextCell*>(node);
+        const auto& str = cell->RefString();
+        ++stats.cell_count;
+        if (cell->ctx.context) ++stats.context_count;
+        stats.string_bytes += str.capacity * sizeof(char16_t);
+        stats.text_bytes += str.length * sizeof(char16_t);
+        // 池中CELL按类别大小, 否则按申请大小
+        if (cell->IsPooled()) {
+            ++stats.cell_pooled;
+            stats.cell_bytes += m_pools[RichED::GetCellClass(str.capacity)].GetObjectSize();
+        }
+        else {
+            stats.cell_bytes += sizeof(CEDTextCell);
+            if (cell->RefMetaInfo().metatype >= Type_InlineObject)
+                stats.cell_bytes += str.data[1];
+        }
+    }
+    for (auto& pool : m_pools) stats.pool_bytes += pool.GetChunkBytes();
+    // 缓存
+    stats.logic_size = m_vLogic.GetSize();
+    stats.logic_capacity = m_vLogic.GetCapacity();
+    stats.visual_size = m_vVisual.GetSize();
+    stats.visual_capacity = m_vVisual.GetCapacity();
+    stats.selection_size = m_vSelection.GetSize();
+    stats.selection_capacity = m_vSelection.GetCapacity();
+    stats.buffer_bytes = sizeof(LogicLine) * stats.logic_capacity
+        + sizeof(VisualLine) * stats.visual_capacity
+        + sizeof(unit_t) * m_height.GetCapacity()
+        + sizeof(uint32_t) * m_vWrap.GetCapacity()
+        + sizeof(Box) * stats.selection_capacity;
+    // 撤销栈
+    m_undo.GetStats(stats.undo_count, stats.undo_bytes);
+    stats.style_bytes = m_styles.GetByteSize();
+    return stats;
+}
+
 /// <summary>
 /// Gens the text.
 /// </summary>
@@ -1032,7 +1416,8 @@ void RichED::CEDTextDocument::Private::GenText(
 /// GetEstimatedSize in view sapce
 /// </summary>
 /// <returns></returns>
-auto RichED::CEDTextDocument::GetEstimatedSize() const noexcept -> Size {
+auto RichED::CEDTextDocument::GetEstimatedSize() noexcept -> Size {
+    this->EndLayoutAsync();
     auto size = m_szEstimated;
     if (m_matrix.read_direction & 1) std::swap(size.width, size.height);
     return size;
@@ -1046,6 +1431,7 @@ auto RichED::CEDTextDocument::GetEstimatedSize() const noexcept -> Size {
 /// <param name="end">The end.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::GenText(CtxPtr ctx, DocPoint begin, DocPoint end) noexcept {
+    this->EndLayoutAsync();
     auto& plat = this->platform;
     const auto lf = m_linefeed.View();
     // XXX: AppendText OOM处理
@@ -1064,11 +1450,30 @@ void RichED::CEDTextDocument::GenText(CtxPtr ctx, DocPoint begin, DocPoint end)
 /// <param name="lf">The lf.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::SetLineFeed(const LineFeed lf) noexcept {
+    this->EndLayoutAsync();
     m_linefeed = lf;
     // 文本修改
     Private::ValueChanged(*this, Changed_Text);
 }
 
+/// <summary>
+/// Sets the text align.
+/// </summary>
+/// <param name="ta">The text align.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::SetTextAlign(TextAlign ta) noexcept {
+    this->EndLayoutAsync();
+    if (m_info.talign == ta) return;
+    m_info.talign = ta;
+    // 不重建CELL: 视口内的行在Update时对齐, 其余行用到时再对齐
+    Private::Realign(*this);
+    Private::RefreshCaret(*this, m_dpCaret, nullptr);
+    if (Cmp(m_dpSelBegin) < Cmp(m_dpSelEnd)) {
+        Private::RefreshSelection(*this, m_dpSelBegin, m_dpSelEnd);
+        Private::ValueChanged(*this, Changed_Selection);
+    }
+}
+
 /// <summary>
 /// valign helper
 /// </summary>
@@ -1103,26 +1508,109 @@ void RichED::CEDTextDocument::VAlignHelperH(unit_t ar, unit_t height, CellMetric
 /// </summary>
 /// <returns></returns>
 void RichED::CEDTextDocument::ForceResetAllRiched() noexcept {
+    this->EndLayoutAsync();
+    const auto style = Private::DefaultStyle(*this);
+    if (style == TEXT_STYLE_INVALID) return;
     // 遍历所有节点
     auto cell = impl::next_cell(&m_head);
     while (cell != &m_tail) {
         const auto node = cell;
         cell = impl::next_cell(cell);
-        node->SetRichED(this->default_riched);
+        node->SetStyle(style);
+        node->AsDirty();
         node->Sleep();
     }
     // 标记为脏
-    m_vVisual.ReduceSize(1);
+    Private::ResetVL(*this);
+    Private::ClearWrap(*this);
     //Private::Dirty(*this, *impl::next_cell(&m_head), 0);
     Private::NeedRedraw(*this);
     Private::RefreshCaret(*this, m_dpCaret, nullptr);
 }
 
+/// <summary>
+/// Compacts cells from the logic line.
+/// </summary>
+/// <param name="line">The logic line.</param>
+/// <param name="budget">The budget, cell count to visit.</param>
+/// <returns></returns>
+auto RichED::CEDTextDocument::Compact(uint32_t line, uint32_t budget) noexcept -> CompactInfo {
+    this->EndLayoutAsync();
+    CompactInfo info = { line, 0, 0 };
+    const auto count = m_vLogic.GetSize();
+    // 合并过的逻辑行范围[dirty, dirty_end)
+    auto dirty = count, dirty_end = count;
+    // 以逻辑行为单位, 预算用完后在行尾停止
+    while (info.next_line < count && info.cell_before < budget) {
+        auto& line_data = m_vLogic[info.next_line];
+        for (auto cell = line_data.first; ; cell = impl::next_cell(cell)) {
+            ++info.cell_before;
+            ++info.cell_after;
+            // 尽量吸收后面的CELL, 直至填满
+            while (const auto obj = cell->MergeWithNextEx()) {
+                if (cell == line_data.first) line_data.first = obj;
+                cell = obj;
+                ++info.cell_before;
+                if (dirty == count) dirty = info.next_line;
+                dirty_end = info.next_line + 1;
+            }
+            if (cell->RefMetaInfo().eol) break;
+        }
+        ++info.next_line;
+    }
+    // 仅将修改过的逻辑行标记为脏, 之后的视觉行保留
+    if (dirty != count) {
+        Private::Dirty(*this, dirty, dirty_end - dirty);
+        // 合并可能移动了CELL: 重新布局的起点与后续干净视觉行的最后一个在使用前重新指向首CELL
+        Private::NeedRedraw(*this);
+    }
+    return info;
+}
+
+/// <summary>
+/// Begins laying out rest lines on background thread.
+/// </summary>
+/// <returns>false if nothing to lay out or worker thread not created</returns>
+bool RichED::CEDTextDocument::BeginLayoutAsync() noexcept {
+    if (m_worker.IsRunning()) return true;
+    if (m_vVisual.IsFailed()) return false;
+    // 已经处理完毕
+    if (m_vVisual[m_vVisual.GetSize() - 1].first == &m_tail) return false;
+    // 线程创建失败时调用方应改用Update(budget)
+    return m_worker.Resume(Private::LayoutStep, this);
+}
+
+/// <summary>
+/// Ends the background layout.
+/// </summary>
+/// <returns></returns>
+void RichED::CEDTextDocument::EndLayoutAsync() noexcept {
+    // 等待当前步骤完成后, 后台布局的视觉行对本线程可见
+    if (!m_worker.Pause()) return;
+    Private::ValueChanged(*this, Changed_LayoutAsync);
+    Private::CheckEstimated(*this);
+    m_szEstimatedCmp = m_szEstimated;
+}
+
+/// <summary>
+/// Lays out all lines.
+/// </summary>
+/// <param name="thread_count">The thread count.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::LayoutAll(uint32_t thread_count) noexcept {
+    this->EndLayoutAsync();
+    Private::ParallelVL(*this, thread_count);
+    // 估计行同样需要布局
+    while (Private::GapVL(*this)) Private::ParallelVL(*this, thread_count);
+    Private::NeedRedraw(*this);
+}
+
 /// <summary>
 /// Begins the op.
 /// </summary>
 /// <returns></returns>
 void RichED::CEDTextDocument::BeginOp() noexcept {
+    this->EndLayoutAsync();
     assert(m_uUndoOp == 0);
     m_uUndoOp = m_uUndoIsOk;
 }
@@ -1133,6 +1621,7 @@ void RichED::CEDTextDocument::BeginOp() noexcept {
 /// </summary>
 /// <returns></returns>
 void RichED::CEDTextDocument::EndOp() noexcept {
+    this->EndLayoutAsync();
     assert(m_uUndoOp >= m_uUndoIsOk);
     m_uUndoOp = 0;
     // 检查撤销栈长度
@@ -1205,6 +1694,7 @@ bool RichED::CEDTextDocument::Private::DeleteSelection(CEDTextDocument & doc) no
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiLButtonDown(Point pt, bool shift) noexcept {
+    this->EndLayoutAsync();
     return Private::Mouse(*this, pt, false);
 }
 
@@ -1214,6 +1704,7 @@ bool RichED::CEDTextDocument::GuiLButtonDown(Point pt, bool shift) noexcept {
 /// <param name="pt">The pt.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiLButtonHold(Point pt) noexcept {
+    this->EndLayoutAsync();
     return Private::Mouse(*this, pt, true);
 }
 
@@ -1223,6 +1714,7 @@ bool RichED::CEDTextDocument::GuiLButtonHold(Point pt) noexcept {
 /// <param name="ch">The ch.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiChar(char32_t ch) noexcept {
+    this->EndLayoutAsync();
 #ifndef NDEBUG
     if (!((ch >= 0x20 && ch != 0x7f) || ch == '\t')) {
         const auto msg = "<CEDTextDocument::GuiChar>: control char NOT accepted.";
@@ -1241,6 +1733,7 @@ bool RichED::CEDTextDocument::GuiChar(char32_t ch) noexcept {
 /// <param name="view">The view.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiText(U16View view) noexcept {
+    this->EndLayoutAsync();
     assert(view.second >= view.first);
     // 只读
     if (m_info.flags & Flag_GuiReadOnly) return false;
@@ -1387,6 +1880,7 @@ auto RichED::CEDTextDocument::password_helper16(
 /// <param name="ctrl">if set to <c>true</c> [control].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiBackspace(bool ctrl) noexcept {
+    this->EndLayoutAsync();
     // 只读
     if (m_info.flags & Flag_GuiReadOnly) return false;
     // 开始记录
@@ -1413,6 +1907,7 @@ bool RichED::CEDTextDocument::GuiBackspace(bool ctrl) noexcept {
 /// <param name="ctrl">if set to <c>true</c> [control].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiDelete(bool ctrl) noexcept {
+    this->EndLayoutAsync();
     // 只读
     if (m_info.flags & Flag_GuiReadOnly) return false;
     // 开始记录
@@ -1437,6 +1932,7 @@ bool RichED::CEDTextDocument::GuiDelete(bool ctrl) noexcept {
 /// </summary>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiReturn() noexcept {
+    this->EndLayoutAsync();
     // 单行
     if (m_info.flags & Flag_MultiLine) {
         const char16_t line_feed[1] = { '\n' };
@@ -1453,6 +1949,7 @@ bool RichED::CEDTextDocument::GuiReturn() noexcept {
 /// <param name="riched">The riched.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiRuby(char32_t ch, U16View ruby, const RichData* riched) noexcept {
+    this->EndLayoutAsync();
     // 无效
     if (ruby.first == ruby.second) return false;
     // 只读
@@ -1477,6 +1974,7 @@ bool RichED::CEDTextDocument::GuiRuby(char32_t ch, U16View ruby, const RichData*
 /// <param name="type">The type.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiInline(const InlineInfo& info, int16_t len, CellType type) noexcept {
+    this->EndLayoutAsync();
     // 无效
     if (len <= 0) return false;
     // 只读
@@ -1504,6 +2002,7 @@ bool RichED::CEDTextDocument::GuiInline(const InlineInfo& info, int16_t len, Cel
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiLeft(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     assert(ctrl == 0 || ctrl == 1);
     const uint32_t mode = m_matrix.left_mapper + ctrl;
     Private::SetSelection(*this, nullptr, m_dpCaret, mode, shift);
@@ -1519,6 +2018,7 @@ bool RichED::CEDTextDocument::GuiLeft(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiRight(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     assert(ctrl == 0 || ctrl == 1);
     const uint32_t mode = m_matrix.right_mapper + ctrl;
     Private::SetSelection(*this, nullptr, m_dpCaret, mode, shift);
@@ -1534,6 +2034,7 @@ bool RichED::CEDTextDocument::GuiRight(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiUp(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     return true;
 }
 
@@ -1545,6 +2046,7 @@ bool RichED::CEDTextDocument::GuiUp(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiDown(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     return true;
 }
 
@@ -1556,6 +2058,7 @@ bool RichED::CEDTextDocument::GuiDown(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiHome(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     assert(ctrl == 0 || ctrl == 1);
     Private::SetSelection(*this, nullptr, m_dpCaret, impl::mode_home + ctrl, shift);
     Private::UpdateSelection(*this, m_dpCaret, m_dpAnchor);
@@ -1569,6 +2072,7 @@ bool RichED::CEDTextDocument::GuiHome(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiEnd(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     assert(ctrl == 0 || ctrl == 1);
     Private::SetSelection(*this, nullptr, m_dpCaret, impl::mode_end + ctrl, shift);
     Private::UpdateSelection(*this, m_dpCaret, m_dpAnchor);
@@ -1582,6 +2086,7 @@ bool RichED::CEDTextDocument::GuiEnd(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiPageUp(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     return false;
 }
 
@@ -1592,6 +2097,7 @@ bool RichED::CEDTextDocument::GuiPageUp(bool ctrl, bool shift) noexcept {
 /// <param name="shift">if set to <c>true</c> [shift].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiPageDown(bool ctrl, bool shift) noexcept {
+    this->EndLayoutAsync();
     return false;
 }
 
@@ -1601,6 +2107,7 @@ bool RichED::CEDTextDocument::GuiPageDown(bool ctrl, bool shift) noexcept {
 /// </summary>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiSelectAll() noexcept {
+    this->EndLayoutAsync();
     // 设置选择区
     Private::SetSelection(*this, nullptr, {}, impl::mode_all, true);
     // 更新选择区
@@ -1615,6 +2122,7 @@ bool RichED::CEDTextDocument::GuiSelectAll() noexcept {
 /// <param name="shift_direction">if set to <c>true</c> [shift direction].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiSrcollView(unit_t, bool shift_direction) noexcept {
+    this->EndLayoutAsync();
     return false;
 }
 
@@ -1623,6 +2131,7 @@ bool RichED::CEDTextDocument::GuiSrcollView(unit_t, bool shift_direction) noexce
 /// </summary>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiUndo() noexcept {
+    this->EndLayoutAsync();
     return m_undo.Undo(*this);
 }
 
@@ -1631,6 +2140,7 @@ bool RichED::CEDTextDocument::GuiUndo() noexcept {
 /// </summary>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiRedo() noexcept {
+    this->EndLayoutAsync();
     return m_undo.Redo(*this);
 }
 
@@ -1640,7 +2150,8 @@ bool RichED::CEDTextDocument::GuiRedo() noexcept {
 /// </summary>
 /// <returns></returns>
 bool RichED::CEDTextDocument::GuiHasText() const noexcept {
-    return m_vLogic.GetSize() && m_vLogic[0].first->RefString().length;
+    // 后台布局会拆分CELL, 只读逻辑行长度(后台不修改)
+    return m_vLogic.GetSize() && m_vLogic[0].length;
 }
 
 // ----------------------------------------------------------------------------
@@ -1657,10 +2168,13 @@ bool RichED::CEDTextDocument::GuiHasText() const noexcept {
 /// <param name="relayout">if set to <c>true</c> [relayout].</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::gui_riched(uint32_t offset, uint32_t size, const void * data, bool relayout) noexcept {
+    this->EndLayoutAsync();
     // 只读
     if (m_info.flags & Flag_GuiReadOnly) return false;
     // TODO: 没有选择的时候应该将默认的富属性修改为目标?
     if (Cmp(m_dpSelBegin) == Cmp(m_dpSelEnd)) return false;
+    // 样式表快满了: 记录开始前压缩
+    if (m_styles.GetCount() >= TEXT_STYLE_COMPACT_COUNT) Private::CompactStyle(*this);
     // 尝试记录
     impl::op_recorder recorder{ *this };
     // 正式调用
@@ -1684,10 +2198,13 @@ bool RichED::CEDTextDocument::gui_riched(uint32_t offset, uint32_t size, const v
 /// <param name="set">The set.</param>
 /// <returns></returns>
 bool RichED::CEDTextDocument::gui_flags(uint16_t flags, uint32_t set) noexcept {
+    this->EndLayoutAsync();
     // 只读
     if (m_info.flags & Flag_GuiReadOnly) return false;
     // TODO: 没有选择的时候应该将默认的富属性修改为目标?
     if (Cmp(m_dpSelBegin) == Cmp(m_dpSelEnd)) return false;
+    // 样式表快满了: 记录开始前压缩
+    if (m_styles.GetCount() >= TEXT_STYLE_COMPACT_COUNT) Private::CompactStyle(*this);
     // 尝试记录
     impl::op_recorder recorder{ *this };
     // 正式调用
@@ -1718,16 +2235,31 @@ bool RichED::CEDTextDocument::set_riched(
     DocPoint begin, DocPoint end,
     uint32_t offset, uint32_t size,
     const void * data, bool relayout) noexcept {
+    this->EndLayoutAsync();
     CheckRangeCtx ctx;
     RichExCtx richex;
     CellPoint cp[2];
-    // 修改数据
-    const auto set_data = [data, offset, size](CEDTextCell& cell) noexcept {
-        auto& rd = const_cast<RichData&>(cell.RefRichED());
-        char* const dst = reinterpret_cast<char*>(&rd);
-        const char* const src = reinterpret_cast<const char*>(data);
-        std::memcpy(dst + offset, src, size);
-        cell.AsDirty();
+    // 补丁放在默认数据上
+    RichData patch = this->default_riched;
+    std::memcpy(reinterpret_cast<char*>(&patch) + offset, data, size);
+    // 修改数据: 同样式的CELL大多连续, 缓存上一次的映射
+    uint16_t last_old = TEXT_STYLE_INVALID, last_new = TEXT_STYLE_INVALID;
+    // 字体有变化才需要重新布局
+    bool font_changed = false;
+    const auto set_data = [&, offset, size](CEDTextCell& cell) noexcept {
+        const auto old = cell.GetStyle();
+        if (old != last_old) {
+            RichData rd = this->RefStyle(old);
+            const auto src = reinterpret_cast<const char*>(&patch);
+            std::memcpy(reinterpret_cast<char*>(&rd) + offset, src + offset, size);
+            last_new = this->InternStyle(rd);
+            last_old = old;
+            if (last_new != TEXT_STYLE_INVALID && !CEDStyleTable::SameFont(
+                this->RefStyle(old), this->RefStyle(last_new))) font_changed = true;
+        }
+        if (last_new == TEXT_STYLE_INVALID) return false;
+        cell.SetStyle(last_new);
+        return true;
     };
     // 检测范围合理性
     if (!Private::CheckRange(*this, begin, end, ctx)) return false;
@@ -1739,11 +2271,11 @@ bool RichED::CEDTextDocument::set_riched(
     if (Private::IsRecord(*this)) {
         richex.op.begin = begin;
         richex.op.end = end;
-        richex.op.riched = this->default_riched;
+        richex.op.style = this->InternStyle(patch);
         richex.offset = offset;
         richex.length = size;
         richex.relayout = relayout;
-        std::memcpy(reinterpret_cast<char*>(&richex.op.riched) + offset, data, size);
+        if (richex.op.style == TEXT_STYLE_INVALID) return false;
         // 记录富属性
         Private::RecordRich(*this, begin, ctx, &richex);
     }
@@ -1752,28 +2284,20 @@ bool RichED::CEDTextDocument::set_riched(
     const auto pos1 = cp[0].offset;
     const auto cell2 = cp[1].cell;
     const auto pos2 = cp[1].offset;
+    const bool split1 = pos1 && pos1 < cell1->RefString().length;
+    const bool split2 = pos2 && pos2 < cell2->RefString().length;
     // 细胞分裂: 由于cell1可能等于cell2, 所以先分裂cell2
     const auto e = cell2->Split(pos2);
     const auto b = cell1->Split(pos1);
     if (b && e) {
         const auto cfor = impl::cfor_cells(b, e);
-        for (auto& cell : cfor) set_data(cell);
+        bool rv = true;
+        for (auto& cell : cfor) if (!(rv = set_data(cell))) break;
         // 重新布局
-        if (relayout) Private::Dirty(*this, *cell1, begin.line);
-        // 增量布局
-        else {
-            if (cell1 != b) {
-                this->recreate_context(*cell1);
-                b->metrics.pos = cell1->metrics.pos + cell1->metrics.width;
-            }
-            if (cell2 != e) {
-                // 可能cell1 == cell2
-                const auto current = static_cast<CEDTextCell*>(e->prev);
-                this->recreate_context(*current);
-                e->metrics.pos = current->metrics.pos + current->metrics.width;
-            }
-        }
-        return true;
+        if (relayout && font_changed) Private::Dirty(*this, begin.line, end.line - begin.line + 1);
+        // 字体不变: 只有分裂了CELL的两端逻辑行需要重新布局
+        else Private::DirtySplit(*this, begin.line, end.line, split1, split2);
+        return rv;
     }
     return false;
 }
@@ -1791,6 +2315,7 @@ bool RichED::CEDTextDocument::set_riched(
 bool RichED::CEDTextDocument::set_flags(
     DocPoint begin, DocPoint end, 
     uint16_t flags, uint32_t set) noexcept {
+    this->EndLayoutAsync();
     RichExCtx richex;
     CheckRangeCtx ctx;
     // 检测范围合理性
@@ -1799,13 +2324,15 @@ bool RichED::CEDTextDocument::set_flags(
     //if (!Private::RichRange(ctx, cp)) return false;
     // 处理存在撤销栈的情况
     if (Private::IsRecord(*this)) {
+        RichData rd = this->default_riched;
+        rd.fflags = static_cast<FFlags>(flags);
         richex.op.begin = begin;
         richex.op.end = end;
-        richex.op.riched = this->default_riched;
-        richex.op.riched.fflags = static_cast<FFlags>(flags);
+        richex.op.style = this->InternStyle(rd);
         richex.offset = set;
         richex.length = 0;
         richex.relayout = false;
+        if (richex.op.style == TEXT_STYLE_INVALID) return false;
         // 记录富属性
         Private::RecordRich(*this, begin, ctx, &richex);
     }
@@ -1826,8 +2353,7 @@ bool RichED::CEDTextDocument::set_flags(
     static_assert(sizeof(RichData::fflags) == sizeof(uint16_t), "same!");
     static_assert(sizeof(RichData::effect) == sizeof(uint16_t), "same!");
     // 获取标志
-    const auto ref_flags = [flag_offset](CEDTextCell& cell) noexcept -> uint16_t& {
-        auto& rd = const_cast<RichData&>(cell.RefRichED());
+    const auto ref_flags = [flag_offset](RichData& rd) noexcept -> uint16_t& {
         char* const dst = reinterpret_cast<char*>(&rd);
         uint16_t* const rv = reinterpret_cast<uint16_t*>(dst + flag_offset);
         return *rv;
@@ -1835,7 +2361,8 @@ bool RichED::CEDTextDocument::set_flags(
     // 修改模式
     if (set & Set_Change) {
         // 检查修改点两端的情况: 两段都为true时修改为false, 否则修改为true;
-        if ((ref_flags(*cell1) & ref_flags(*cell2) & flags) == flags)
+        RichData rd1 = cell1->RefRichED(), rd2 = cell2->RefRichED();
+        if ((ref_flags(rd1) & ref_flags(rd2) & flags) == flags)
             set = Set_False;
         else
             set = Set_True;
@@ -1843,37 +2370,36 @@ bool RichED::CEDTextDocument::set_flags(
     // 与或标志
     const uint16_t and_flags = ~flags;
     const uint16_t or__flags = set & Set_True ? flags : 0;
-    // 修改数据
-    const auto set_data = [=](CEDTextCell& cell) noexcept {
-        auto& flags = ref_flags(cell);
-        flags = (flags & and_flags) | or__flags;
+    // 修改数据: 同样式的CELL大多连续, 缓存上一次的映射
+    uint16_t last_old = TEXT_STYLE_INVALID, last_new = TEXT_STYLE_INVALID;
+    const auto set_data = [&](CEDTextCell& cell) noexcept {
+        const auto old = cell.GetStyle();
+        if (old != last_old) {
+            RichData rd = this->RefStyle(old);
+            auto& flags = ref_flags(rd);
+            flags = (flags & and_flags) | or__flags;
+            last_new = this->InternStyle(rd);
+            last_old = old;
+        }
+        if (last_new == TEXT_STYLE_INVALID) return false;
+        cell.SetStyle(last_new);
+        return true;
     };
+    const bool split1 = pos1 && pos1 < cell1->RefString().length;
+    const bool split2 = pos2 && pos2 < cell2->RefString().length;
     // 细胞分裂: 由于cell1可能等于cell2, 所以先分裂cell2
     const auto e = cell2->Split(pos2);
     const auto b = cell1->Split(pos1);
     if (b && e) {
         const auto cfor = impl::cfor_cells(b, e);
         Private::NeedRedraw(*this);
-        for (auto& cell : cfor) set_data(cell);
+        bool rv = true;
+        for (auto& cell : cfor) if (!(rv = set_data(cell))) break;
         // 重新布局
-        if (change_font_flags) {
-            for (auto& cell : cfor) cell.AsDirty();
-            Private::Dirty(*this, *cell1, begin.line);
-        }
-        // 增量布局
-        else {
-            if (cell1 != b) {
-                this->recreate_context(*cell1);
-                b->metrics.pos = cell1->metrics.pos + cell1->metrics.width;
-            }
-            if (cell2 != e) {
-                // 可能cell1 == cell2
-                const auto current = static_cast<CEDTextCell*>(e->prev);
-                this->recreate_context(*current);
-                e->metrics.pos = current->metrics.pos + current->metrics.width;
-            }
-        }
-        return true;
+        if (change_font_flags) Private::Dirty(*this, begin.line, end.line - begin.line + 1);
+        // 字体不变: 只有分裂了CELL的两端逻辑行需要重新布局
+        else Private::DirtySplit(*this, begin.line, end.line, split1, split2);
+        return rv;
     }
     return false;
 }
@@ -1885,49 +2411,52 @@ bool RichED::CEDTextDocument::set_flags(
 
 
 /// <summary>
-/// Expands the visual-line clean area.
+/// Lays out one logic line.
 /// </summary>
 /// <param name="doc">The document.</param>
-/// <param name="target_line">The target line.</param>
-/// <param name="bottom">The bottom.</param>
+/// <param name="line">The first visual line of the logic line.</param>
+/// <param name="est_width">The estimated width.</param>
+/// <param name="push">The push call.</param>
+/// <param name="mutex">The mutex for cell list.</param>
 /// <returns></returns>
-void RichED::CEDTextDocument::Private::ExpandVL(
-    CEDTextDocument& doc, uint32_t target_line, unit_t bottom) noexcept {
-    auto& vlv = doc.m_vVisual;
-    if (vlv.IsFailed()) return;
-    assert(vlv.GetSize() && "bad size");
-    // 保证最后一个准确
-    const uint32_t count = vlv.GetSize() - 1;
-    auto& last = vlv[count];
-    assert(last.char_len_before == 0);
-    // 已经处理完毕
-    if (last.first == &doc.m_tail) return;
-    // TODO: 保证最后一个准确, 移动至Dirty函数
-    last.first = doc.m_vLogic[last.lineno].first;
+template<typename T, typename M>
+bool RichED::CEDTextDocument::Private::WrapLine(
+    CEDTextDocument& doc, VisualLine& line, unit_t& est_width, T push, M& mutex) noexcept {
+    assert(line.char_len_before == 0);
     // 视口宽度, 用于自动换行
     const auto viewport_w = doc.m_rcViewport.width;
-    // 获取
-    auto line = last;
     auto cell = line.first;
-    // 已经处理完毕
-    if (line.lineno > target_line) return;
-    if (line.offset >= bottom) return;
-    // 估计宽度: 如果从0开始则从0计算宽度
-    auto est_width = doc.m_szEstimated.width;
-    if (!count) est_width = 0;
-
-#ifndef NDEBUG
-    doc.platform.DebugOutput("<ExpandVL>", false);
-#endif // !NDEBUG
-
-
-    // 正式开始
-    vlv.Resize(count, doc.platform);
     line.ar_height_max = line.dr_height_max = 0;
+    line.estimated = 0;
+    line.aligned = 0;
+    // 换行缓存: 命中时直接使用之前的断点, 否则记录断点
+    const auto lineno = line.lineno;
+    const auto cached = doc.m_info.wrap_mode ? Private::FindWrap(doc, lineno) : nullptr;
+    uint32_t breaks[WRAP_CACHE_BREAK];
+    uint32_t break_count = 0;
+    bool checked = false;
+    // 断行机会: 整个逻辑行一次计算, 与宽度无关
+    const auto line_first = cell;
+    const uint32_t* opportunity = nullptr;
+    uint32_t* opportunity_new = nullptr;
+    uint32_t opportunity_local[WRAP_BREAK_LOCAL];
+    CEDBuffer<uint32_t> opportunity_buf;
+    const auto find_opportunity = [&]() noexcept {
+        if ((opportunity = Private::FindBreak(doc, lineno))) return;
+        // 短逻辑行不用分配
+        const auto words = impl::break_words(doc.m_vLogic[lineno].length);
+        if (words <= WRAP_BREAK_LOCAL) opportunity_new = opportunity_local;
+        else if (opportunity_buf.Resize(words, doc.platform)) opportunity_new = opportunity_buf.GetData();
+        else return;
+        Private::LineBreaks(doc, *line_first, words, opportunity_new);
+        opportunity = opportunity_new;
+    };
+    const auto record = [&breaks, &break_count](uint32_t pos) noexcept {
+        if (break_count < WRAP_CACHE_BREAK) breaks[break_count] = pos;
+        ++break_count;
+    };
     unit_t offset_inline = 0;
     uint32_t char_length_vl = 0;
-    //uintptr_t new_line = 0;
-    // 起点为无效起点
     while (cell != &doc.m_tail) {
         /*
          1. 在'条件允许'下尝试合并后面的CELL
@@ -1938,9 +2467,11 @@ void RichED::CEDTextDocument::Private::ExpandVL(
         */
 
 
-        // 尝试合并后CELL
-        if (Private::Merge(doc, *cell, viewport_w, offset_inline)) 
+        // 尝试合并后CELL: 修改链表需要加锁
+        if (Private::Merge(doc, *cell, viewport_w, offset_inline) && cell->CanMergeWithNext()) {
+            std::lock_guard<M> lock{ mutex };
             cell->MergeWithNext();
+        }
 
         bool this_eol = cell->RefMetaInfo().eol;
         bool new_line = this_eol;
@@ -1952,29 +2483,44 @@ void RichED::CEDTextDocument::Private::ExpandVL(
         const auto offset_end = offset_inline + cell->metrics.width;
         if (doc.m_info.wrap_mode && offset_end > viewport_w && cell->metrics.width > 0) {
             // 整个CELL换行
-            if (cell->RefMetaInfo().metatype >= Type_InlineObject ||
-                offset_inline + cell->RefRichED().size > viewport_w ||
-                Private::CheckWrap(doc, *cell, viewport_w - offset_inline) == cell
-                ) {
+            uint32_t split = 0;
+            if (cell->RefMetaInfo().metatype < Type_InlineObject &&
+                offset_inline + cell->RefRichED().size <= viewport_w) {
+                const auto length = cell->RefString().length;
+                const auto begin = line.char_len_before + char_length_vl;
+                if (cached) split = impl::cached_wrap(cached, line.char_len_before, begin, length);
+                else {
+                    if (!opportunity && (doc.m_info.wrap_mode & 3) != Mode_Anywhere) find_opportunity();
+                    // 视觉行至少保留一个字符
+                    const auto min = line.char_len_before + 1 > begin ? line.char_len_before + 1 - begin : 0;
+                    split = Private::CheckWrap(doc, *cell, viewport_w - offset_inline, opportunity, begin, min);
+                    checked = true;
+                }
+            }
+            if (!split) {
                 // -------------------------
                 // --------------------- BOVL
                 // -------------------------
                 line.char_len_this = char_length_vl;
                 // 换行
-                if (!impl::push_data(vlv, line, doc.platform)) return;
+                if (!push(line)) return false;
                 cell->metrics.pos = 0;
                 // 这里换行不是逻辑
                 line.char_len_before += char_length_vl;
+                record(line.char_len_before);
                 char_length_vl = 0;
                 offset_inline = 0;
-                // 行偏移 = 上一行偏移 + 上一行最大升高 + 上一行最大降高
                 line.first = cell;
-                line.offset += line.ar_height_max + line.dr_height_max;
                 line.ar_height_max = cell->metrics.ar_height;
                 line.dr_height_max = cell->metrics.dr_height;
             }
             // 其他情况
             else {
+                // 分裂失败时同样在此换行
+                if (split < cell->RefString().length) {
+                    std::lock_guard<M> lock{ mutex };
+                    cell->Split(split);
+                }
                 new_line = true;
                 this_eol = cell->RefMetaInfo().eol;
                 // 重建脏CELL
@@ -1998,63 +2544,715 @@ void RichED::CEDTextDocument::Private::ExpandVL(
         // 换行
         if (new_line) {
             line.char_len_this = char_length_vl;
-            if (!impl::push_data(vlv, line, doc.platform)) return;
+            if (!push(line)) return false;
             line.char_len_before += char_length_vl;
             char_length_vl = 0;
             line.lineno += cell->RefMetaInfo().eol;
             if (cell->RefMetaInfo().eol) line.char_len_before = 0;
+            else record(line.char_len_before);
             line.first = impl::next_cell(cell);
-            // 行偏移 = 上一行偏移 + 上一行最大升高 + 上一行最大降高
-            line.offset += line.ar_height_max + line.dr_height_max;
             line.ar_height_max = 0;
             line.dr_height_max = 0;
             offset_inline = 0;
-            // 中断检测
+            // 逻辑行结束: 记录换行缓存, 并行布局时缓存只读
             if (this_eol) {
-                // 超过视口 或者完成指定行
-                if (line.offset >= bottom || line.lineno > target_line) break;
+                constexpr bool serial = std::is_same<M, impl::null_mutex>::value;
+                if (serial && checked)
+                    Private::SaveWrap(doc, lineno, opportunity_new, breaks, break_count);
+                return true;
             }
         }
         // 推进
         cell = impl::next_cell(cell);
     }
-    // 末尾
-    push_data(vlv, line, doc.platform);
+    line.first = cell;
+    return true;
+}
+
+/// <summary>
+/// Expands the visual-line clean area.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="target_line">The target line.</param>
+/// <param name="bottom">The bottom.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ExpandVL(
+    CEDTextDocument& doc, uint32_t target_line, unit_t bottom) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return;
+    assert(vlv.GetSize() && "bad size");
+    // 保证最后一个准确
+    const uint32_t count = vlv.GetSize() - 1;
+    auto& last = vlv[count];
+    assert(last.char_len_before == 0);
+    // 已经处理完毕
+    if (last.first == &doc.m_tail) return;
+    // TODO: 保证最后一个准确, 移动至Dirty函数
+    last.first = doc.m_vLogic[last.lineno].first;
+    // 获取
+    auto line = last;
+    // 已经处理完毕
+    if (line.lineno > target_line) return;
+    auto line_offset = Private::OffsetVL(doc, count);
+    if (line_offset >= bottom) return;
+    // 估计宽度: 如果从0开始则从0计算宽度
+    auto est_width = doc.m_szEstimated.width;
+    if (!count) est_width = 0;
+
+#ifndef NDEBUG
+    doc.platform.DebugOutput("<ExpandVL>", false);
+#endif // !NDEBUG
+
+
+    // 正式开始
+    vlv.Resize(count, doc.platform);
+    // 行偏移 = 上一行偏移 + 上一行最大升高 + 上一行最大降高
+    const auto push = [&doc, &line_offset](const VisualLine& vl) noexcept {
+        if (!Private::PushVL(doc, vl)) return false;
+        line_offset += Private::HeightVL(doc, vl);
+        return true;
+    };
+    impl::null_mutex mutex;
+    bool spliced = false;
+    // 起点为无效起点
+    while (line.first != &doc.m_tail) {
+        if (!Private::WrapLine(doc, line, est_width, push, mutex)) return;
+        // 预取后面逻辑行的首CELL, 打断链表遍历的依赖链
+        const auto pf = line.lineno + LAYOUT_PREFETCH_LINE;
+        if (pf < doc.m_vLogic.GetSize()) impl::prefetch_cell(doc.m_vLogic[pf].first);
+        // 到达后续干净视觉行
+        if (doc.m_uTailBegin != doc.m_uTailEnd) {
+            const auto& tail = vlv.GetData()[doc.m_uTailBegin];
+            if (line.lineno == tail.lineno + doc.m_iTailDelta) {
+                if (!Private::SpliceVL(doc, line)) return;
+                spliced = true;
+                break;
+            }
+        }
+        // 超过视口 或者完成指定行
+        if (line_offset >= bottom || line.lineno > target_line) break;
+    }
+    // 末尾: 接上的话最后一个就是末尾
+    if (spliced) {
+        line = vlv[vlv.GetSize() - 1];
+        line_offset = Private::OffsetVL(doc, vlv.GetSize() - 1);
+    }
+    else if (!Private::PushVL(doc, line)) return;
     // 估计宽度
     doc.m_szEstimated.width = est_width;
     // 估计高度
-    const auto llen = doc.m_vLogic.GetSize();
-    const auto disl = line.lineno;
-    const auto base = line.offset;
-    assert(disl && "bad display-line");
-    doc.m_szEstimated.height = base * make_div(llen, disl);
+    Private::EstimateVL(doc);
+    // 接上后可能还需要继续
+    if (spliced && line.lineno <= target_line && line_offset < bottom)
+        Private::ExpandVL(doc, target_line, bottom);
 }
 
 
 /// <summary>
-/// Recreates the specified cell.
+/// Guesses the height of logic line.
 /// </summary>
-/// <param name="cell">The cell.</param>
+/// <param name="doc">The document.</param>
+/// <param name="line_h">The height per line.</param>
+/// <param name="char_h">The height per char.</param>
 /// <returns></returns>
-void RichED::CEDTextDocument::Private::Recreate(
-    CEDTextDocument&doc, CEDTextCell& cell) noexcept {
-    // 被注音的
-    if (cell.RefMetaInfo().metatype == Type_UnderRuby) {
-        // 第一次遍历: 重建检查是否重建
-        bool need_create = false;
-        const auto end_cell = [&cell, &need_create]() noexcept {
-            need_create = cell.RefMetaInfo().dirty;
-            auto node = impl::next_cell(&cell);
-            //assert(node->RefMetaInfo().metatype == Type_Ruby);
-            while (node->RefMetaInfo().metatype == Type_Ruby) {
-                need_create |= node->RefMetaInfo().dirty;
-                const auto eol = node->RefMetaInfo().eol;
-                node = impl::next_cell(node);
-                if (eol) break;
+void RichED::CEDTextDocument::Private::GuessVL(
+    const CEDTextDocument& doc, unit_t& line_h, unit_t& char_h) noexcept {
+    // 逻辑行估计为 行高 x (1 + 长度 x 字符宽度 / 视口宽度)
+    const auto size = doc.default_riched.size;
+    line_h = Private::IsFixedLH(doc) ? doc.m_info.fixed_lineheight : size;
+    const auto width = doc.m_rcViewport.width;
+    // 平均字符宽度估计为半个字号
+    const auto wrap = doc.m_info.wrap_mode && width > 0;
+    char_h = wrap ? line_h * half(size) / width : unit_t(0);
+}
+
+/// <summary>
+/// Estimates the height of document.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::EstimateVL(CEDTextDocument& doc) noexcept {
+    const auto& vlv = doc.m_vVisual;
+    const uint32_t count = vlv.GetSize() - 1;
+    const auto& last = vlv[count];
+    // 已经布局的部分: 实测高度
+    const auto measured = Private::OffsetVL(doc, count);
+    if (last.first == &doc.m_tail) {
+        doc.m_szEstimated.height = measured;
+        return;
+    }
+    unit_t line_h, char_h;
+    Private::GuessVL(doc, line_h, char_h);
+    const auto& logic = doc.m_vLogic;
+    // 固定行高且不换行: 视觉行即逻辑行, 精确值
+    if (Private::IsFixedLH(doc) && !doc.m_info.wrap_mode) {
+        doc.m_szEstimated.height = times(line_h, logic.GetSize());
+        return;
+    }
+    // 线性估计可以直接对行数与字符数(单元索引O(log n))求和
+    const auto prefix = doc.m_index.Prefix(*logic[last.lineno].first);
+    const auto rest = times(line_h, logic.GetSize() - last.lineno)
+        + times(char_h, doc.m_index.GetTotal() - prefix);
+    // 用已布局部分的实测/估计比例校正剩余部分, 先验权重为若干行估计值
+    const auto prior = times(line_h, LAYOUT_ESTIMATE_LINE);
+    const auto guess = times(line_h, last.lineno) + times(char_h, prefix);
+    const auto height = measured + rest * (measured + prior) / (guess + prior);
+    // 变化不足一行或者不足1/256时保持不变, 避免滚动条抖动
+    const auto now = doc.m_szEstimated.height;
+    const auto bar = std::max(line_h, now * unit_t(1.0 / 256));
+    if (height < now + bar && now < height + bar) return;
+    doc.m_szEstimated.height = height;
+}
+
+/// <summary>
+/// Skips lines before target line or above top as estimated visual lines.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="target_line">The target line.</param>
+/// <param name="top">The top.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::SkipVL(
+    CEDTextDocument& doc, uint32_t target_line, unit_t top) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return;
+    const uint32_t count = vlv.GetSize() - 1;
+    const auto first = vlv[count].lineno;
+    // 已经处理完毕
+    if (vlv[count].first == &doc.m_tail) return;
+    const auto& logic = doc.m_vLogic;
+    // 最后一行总是布局, 后续干净视觉行前一行同样需要布局以便接上
+    auto end = std::min(target_line, logic.GetSize() - 1);
+    if (doc.m_uTailBegin != doc.m_uTailEnd) {
+        const auto& tail = vlv.GetData()[doc.m_uTailBegin];
+        end = std::min(end, tail.lineno + doc.m_iTailDelta - 1);
+    }
+    if (end < first + LAYOUT_SKIP_LINE) return;
+    unit_t line_h, char_h;
+    Private::GuessVL(doc, line_h, char_h);
+    const auto fixed = Private::IsFixedLH(doc);
+    const auto guess = [&logic, line_h, char_h, fixed](uint32_t i) noexcept {
+        return fixed ? line_h : line_h + times(char_h, logic[i].length);
+    };
+    // 估计底部在视口顶部之上的可以跳过
+    auto offset = Private::OffsetVL(doc, count);
+    auto line = first;
+    for (; line != end; ++line) {
+        const auto height = offset + guess(line);
+        if (height > top) break;
+        offset = height;
+    }
+    // 跳过行数较少时直接布局
+    if (line < first + LAYOUT_SKIP_LINE) return;
+#ifndef NDEBUG
+    doc.platform.DebugOutput("<SkipVL>", false);
+#endif // !NDEBUG
+    // 整个逻辑行作为一个估计视觉行
+    const VisualLine next = { logic[line].first, line, 0, 0, 0, 0, 0, 0 };
+    const auto size = count + (line - first) + 1;
+    const bool tail = doc.m_uTailBegin != doc.m_uTailEnd;
+    // 直接写入; 碰到后续干净视觉行时后移, 间隙成倍增长
+    if (!tail) {
+        if (!vlv.Resize(size, doc.platform)) return;
+    }
+    else {
+        if (size > doc.m_uTailBegin) {
+            const auto move = size - doc.m_uTailBegin + (doc.m_uTailEnd >> 1) + RED_INIT_ARRAY_BUFLEN;
+            if (!vlv.Reserve(doc.m_uTailEnd + move, doc.platform)) {
+                doc.m_uTailBegin = doc.m_uTailEnd = 0;
+                return;
             }
-            return node;
-        }();
-        if (!need_create) return;
+            const auto src = vlv.GetData() + doc.m_uTailBegin;
+            std::memmove(src + move, src, sizeof(VisualLine) * (doc.m_uTailEnd - doc.m_uTailBegin));
+            doc.m_uTailBegin += move;
+            doc.m_uTailEnd += move;
+        }
+        vlv.ExpandSize(size);
+    }
+    const auto data = vlv.GetData();
+    auto itr = data + count;
+    for (auto i = first; i != line; ++i)
+        *itr++ = { logic[i].first, i, 0, logic[i].length, guess(i), 0, 1, 0 };
+    *itr = next;
+    if (fixed) return;
+    // 高度索引线性重建, 后续干净视觉行之前的间隙高度为0
+    const auto rebuild_end = tail ? doc.m_uTailEnd : size;
+    if (tail) for (auto i = size; i != doc.m_uTailBegin; ++i)
+        data[i].ar_height_max = data[i].dr_height_max = 0;
+    if (!doc.m_height.Rebuild(count, count, rebuild_end, data, doc.platform))
+        Private::ResetVL(doc);
+}
+
+/// <summary>
+/// Scales laid-out lines to estimated visual lines for new viewport width.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="old_width">The viewport width of laid-out lines.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ScaleVL(CEDTextDocument& doc, unit_t old_width) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return;
+    const uint32_t count = vlv.GetSize() - 1;
+    const auto new_width = doc.m_rcViewport.width;
+    // 只保留视口之上的行, 最后一行总是布局, 未完成的逻辑行同样丢弃
+    const auto data = vlv.GetData();
+    const auto& logic = doc.m_vLogic;
+    const auto top = std::max(doc.m_rcViewport.y, unit_t(0));
+    const auto index = std::min(Private::FindVL(doc, top), count);
+    const auto end = std::min({ data[index].lineno, data[count].lineno, logic.GetSize() - 1 });
+    // 跳过行数较少时直接重新布局
+    if (end < LAYOUT_SKIP_LINE || old_width <= 0 || new_width <= 0)
+        return Private::ResetVL(doc);
+#ifndef NDEBUG
+    doc.platform.DebugOutput("<ScaleVL>", false);
+#endif // !NDEBUG
+    unit_t line_h, char_h;
+    Private::GuessVL(doc, line_h, char_h);
+    const auto ratio = old_width / new_width;
+    // 每个逻辑行合并为一个估计视觉行: 首行高度不变, 换行部分按宽度比例缩放
+    uint32_t size = 0;
+    for (uint32_t i = 0; data[i].lineno != end; ) {
+        // 已经是估计行(连续缩放时的大部分)只需要修改高度
+        if (data[i].estimated) {
+            auto& vl = data[size++] = data[i++];
+            vl.ar_height_max = line_h + (vl.ar_height_max - line_h) * ratio;
+            continue;
+        }
+        const auto lineno = data[i].lineno;
+        const auto first_h = data[i].ar_height_max + data[i].dr_height_max;
+        unit_t height = 0;
+        for (; data[i].lineno == lineno; ++i) height += data[i].ar_height_max + data[i].dr_height_max;
+        height = first_h + (height - first_h) * ratio;
+        data[size++] = { logic[lineno].first, lineno, 0, logic[lineno].length, height, 0, 1, 0 };
+    }
+    data[size] = { logic[end].first, end, 0, 0, 0, 0, 0, 0 };
+    vlv.ReduceSize(size + 1);
+    doc.m_uTailBegin = doc.m_uTailEnd = 0;
+    if (!Private::IsFixedLH(doc) &&
+        !doc.m_height.Rebuild(0, 0, size + 1, data, doc.platform)) {
+        Private::ResetVL(doc);
+        return;
+    }
+    Private::EstimateVL(doc);
+}
+
+/// <summary>
+/// Lays out estimated visual lines of logic lines [begin, end).
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="begin">The begin.</param>
+/// <param name="end">The end.</param>
+/// <returns></returns>
+bool RichED::CEDTextDocument::Private::FillVL(
+    CEDTextDocument& doc, uint32_t begin, uint32_t end) noexcept {
+    assert(begin < end);
+#ifndef NDEBUG
+    doc.platform.DebugOutput("<FillVL>", false);
+#endif // !NDEBUG
+    auto& vlv = doc.m_vVisual;
+    // 没有后续干净视觉行时原地替换, 否则标记为脏行, 后面的保留在缓存末尾, 布局完毕后接上
+    if (doc.m_uTailBegin == doc.m_uTailEnd) {
+        if (!Private::RefineVL(doc, begin, end)) return false;
+    }
+    else {
+        Private::Dirty(doc, begin, end - begin);
+        Private::ExpandVL(doc, end - 1, max_unit());
+    }
+    // 高度变化后其他估计行可能进入视口
+    Private::NeedRedraw(doc);
+    if (vlv.IsFailed()) return false;
+    const auto itr = RichED::LowerVL(vlv.begin(), vlv.end() - 1, begin);
+    return itr != vlv.end() - 1 && !itr->estimated;
+}
+
+/// <summary>
+/// Lays out estimated visual lines of logic lines [begin, end) in place.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="begin">The begin.</param>
+/// <param name="end">The end.</param>
+/// <returns></returns>
+bool RichED::CEDTextDocument::Private::RefineVL(
+    CEDTextDocument& doc, uint32_t begin, uint32_t end) noexcept {
+    assert(doc.m_uTailBegin == doc.m_uTailEnd);
+    auto& vlv = doc.m_vVisual;
+    const uint32_t size = vlv.GetSize();
+    const uint32_t index = uint32_t(RichED::LowerVL(vlv.begin(), vlv.end() - 1, begin) - vlv.begin());
+    // 估计行每个逻辑行一个视觉行
+    const uint32_t old_count = end - begin;
+    assert(index + old_count < size && vlv[index + old_count - 1].lineno == end - 1);
+    // 先布局到临时缓存
+    CEDBuffer<VisualLine> lines;
+    if (!lines.Reserve(old_count + RED_INIT_ARRAY_BUFLEN, doc.platform)) return false;
+    const auto push = [&lines, &doc](const VisualLine& vl) noexcept {
+        return impl::push_data(lines, vl, doc.platform);
+    };
+    VisualLine line = { doc.m_vLogic[begin].first, begin, 0, 0, 0, 0, 0, 0 };
+    auto est_width = doc.m_szEstimated.width;
+    impl::null_mutex mutex;
+    while (line.lineno < end)
+        if (!Private::WrapLine(doc, line, est_width, push, mutex)) return false;
+    // 后面的视觉行只移动一次, 容量成倍增长
+    const uint32_t count = lines.GetSize();
+    assert(count >= old_count);
+    const auto new_size = size - old_count + count;
+    if (new_size > vlv.GetCapacity() &&
+        !vlv.Reserve(new_size + (new_size >> 1), doc.platform)) return false;
+    vlv.ExpandSize(new_size);
+    const auto data = vlv.GetData();
+    const auto rest = data + index + old_count;
+    std::memmove(data + index + count, rest, sizeof(VisualLine) * (size - index - old_count));
+    std::memcpy(data + index, lines.GetData(), sizeof(VisualLine) * count);
+    data[index + count].first = line.first;
+    // 偏移修正: 重建高度索引, 固定行高不需要
+    if (!Private::IsFixedLH(doc) &&
+        !doc.m_height.Rebuild(index, index, new_size, data, doc.platform)) {
+        Private::ResetVL(doc);
+        return false;
+    }
+    doc.m_szEstimated.width = est_width;
+    Private::EstimateVL(doc);
+    return true;
+}
+
+/// <summary>
+/// Lays out estimated visual lines in viewport.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns>true if any laid out</returns>
+bool RichED::CEDTextDocument::Private::FillViewVL(CEDTextDocument& doc) noexcept {
+    auto& vlv = doc.m_vVisual;
+    const auto top = std::max(doc.m_rcViewport.y, unit_t(0));
+    const auto bottom = doc.m_rcViewport.y + doc.m_rcViewport.height;
+    bool filled = false;
+    while (vlv.IsOK()) {
+        const uint32_t count = vlv.GetSize() - 1;
+        const auto index = std::min(Private::FindVL(doc, top), count);
+        const auto end = vlv.begin() + count;
+        auto itr = vlv.begin() + index;
+        auto offset = Private::OffsetVL(doc, index);
+        // 视口内第一段连续的估计行
+        for (; itr != end && offset < bottom && !itr->estimated; ++itr)
+            offset += Private::HeightVL(doc, *itr);
+        if (itr == end || offset >= bottom) break;
+        auto last = itr;
+        for (; last != end && offset < bottom && last->estimated; ++last)
+            offset += Private::HeightVL(doc, *last);
+        if (!Private::FillVL(doc, itr->lineno, last[-1].lineno + 1)) break;
+        // 实际高度可能小于估计值, 继续扩展到视口底部
+        Private::ExpandVL(doc, uint32_t(-1), bottom);
+        filled = true;
+    }
+    if (!filled) return false;
+    // 上方的行高度有变化, 刷新插入符与选择区
+    Private::RefreshCaret(doc, doc.m_dpCaret, nullptr);
+    if (Cmp(doc.m_dpSelBegin) < Cmp(doc.m_dpSelEnd)) {
+        Private::RefreshSelection(doc, doc.m_dpSelBegin, doc.m_dpSelEnd);
+        Private::ValueChanged(doc, Changed_Selection);
+    }
+    // 插入符/选择区所在估计行布局后视口内容可能移动
+    Private::FillViewVL(doc);
+    return true;
+}
+
+/// <summary>
+/// Applies text align to cells of laid-out visual line if out of date.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="vl">The visual line.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::AlignVL(
+    CEDTextDocument& doc, VisualLine& vl) noexcept {
+    // 估计行还没有布局
+    if (vl.estimated || vl.aligned == doc.m_uAlignGen) return;
+    vl.aligned = doc.m_uAlignGen;
+    const auto last = static_cast<CEDTextCell*>(1[&vl].first->prev);
+    const auto cells = impl::cfor_cells(vl.first, 1[&vl].first);
+    // 行宽与词间隙数量: 布局过的CELL都已重建, 对齐不调用平台
+    unit_t width = 0;
+    uint32_t gaps = 0;
+    for (auto& cell : cells) {
+        assert(!cell.RefMetaInfo().dirty && "laid-out cell should be clean");
+        width += cell.metrics.width;
+        gaps += &cell != last && impl::gap_after(cell);
+    }
+    // 超出视口的行按起始对齐
+    const auto slack = doc.m_rcViewport.width - width;
+    unit_t offset = 0, gap = 0;
+    if (slack > 0) switch (doc.m_info.talign) {
+    case TAlign_Trailing:
+        offset = slack;
+        break;
+    case TAlign_Center:
+        offset = half(slack);
+        break;
+    case TAlign_Justified:
+        // 段落最后一行按起始对齐; 不重建CELL, 只能拉伸CELL之间的词间隙
+        if (gaps && !last->RefMetaInfo().eol) gap = slack * make_div(1, gaps);
+        break;
+    default:
+        break;
+    }
+    for (auto& cell : cells) {
+        cell.metrics.pos = offset;
+        offset += cell.metrics.width;
+        if (&cell != last && impl::gap_after(cell)) offset += gap;
+    }
+}
+
+/// <summary>
+/// Applies text align to visual lines in viewport.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::AlignViewVL(CEDTextDocument& doc) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.GetSize() < 2) return;
+    const uint32_t count = vlv.GetSize() - 1;
+    const auto top = std::max(doc.m_rcViewport.y, unit_t(0));
+    const auto bottom = doc.m_rcViewport.y + doc.m_rcViewport.height;
+    auto index = std::min(Private::FindVL(doc, top), count);
+    auto offset = Private::OffsetVL(doc, index);
+    for (; index != count && offset < bottom; ++index) {
+        Private::AlignVL(doc, vlv[index]);
+        offset += Private::HeightVL(doc, vlv[index]);
+    }
+}
+
+/// <summary>
+/// Truncates visual lines at the first estimated one, keeps rest as clean tail.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns>false if no estimated visual line</returns>
+bool RichED::CEDTextDocument::Private::GapVL(CEDTextDocument& doc) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return false;
+    const auto is_estimated = [](const VisualLine& vl) noexcept { return !!vl.estimated; };
+    const auto end = vlv.end() - 1;
+    const auto itr = std::find_if(vlv.begin(), end, is_estimated);
+    if (itr == end) return false;
+    const auto last = std::find_if_not(itr, end, is_estimated);
+    Private::Dirty(doc, itr->lineno, last->lineno - itr->lineno);
+    return true;
+}
+
+
+/// <summary>
+/// Lays out visual lines in viewport.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="refresh">if set to <c>true</c> [refresh caret and selection].</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ViewVL(CEDTextDocument& doc, bool refresh) noexcept {
+    const auto bottom = doc.m_rcViewport.y + doc.m_rcViewport.height;
+    // 远处的行只估计高度, 视口内的估计行再布局
+    Private::SkipVL(doc, uint32_t(-1), doc.m_rcViewport.y);
+    Private::ExpandVL(doc, uint32_t(-1), bottom);
+    // 视口之前的行布局完毕后再调整插入符, 避免跳过视口
+    if (refresh) {
+        Private::RefreshCaret(doc, doc.m_dpCaret, nullptr);
+        if (Cmp(doc.m_dpSelBegin) < Cmp(doc.m_dpSelEnd)) {
+            Private::RefreshSelection(doc, doc.m_dpSelBegin, doc.m_dpSelEnd);
+            Private::ValueChanged(doc, Changed_Selection);
+        }
+    }
+    Private::FillViewVL(doc);
+    Private::AlignViewVL(doc);
+    Private::CheckEstimated(doc);
+    doc.m_szEstimatedCmp = doc.m_szEstimated;
+}
+
+/// <summary>
+/// Lays out rest lines step by step until deadline.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="deadline">The deadline.</param>
+/// <returns>true if progressed</returns>
+bool RichED::CEDTextDocument::Private::BudgetVL(
+    CEDTextDocument& doc, std::chrono::steady_clock::time_point deadline) noexcept {
+    using clock = std::chrono::steady_clock;
+    auto& vlv = doc.m_vVisual;
+    const auto is_estimated = [](const VisualLine& vl) noexcept { return !!vl.estimated; };
+    const uint32_t line_count = doc.m_vLogic.GetSize();
+    // 每步逻辑行数跨帧调整: 一步用完预算时减半, 不到一半时加倍
+    auto& step = doc.m_uLayoutStep;
+    auto time = clock::now();
+    const auto budget = deadline - time;
+    bool progressed = false;
+    // 至少布局一步以保证进展
+    while (vlv.IsOK()) {
+        const auto& last = vlv[vlv.GetSize() - 1];
+        // 先向后布局到末尾
+        if (last.first != &doc.m_tail) {
+            const auto lineno = last.lineno;
+            Private::ExpandVL(doc, lineno + step, max_unit());
+            if (vlv.IsFailed() || vlv[vlv.GetSize() - 1].lineno <= lineno) break;
+        }
+        // 再原地布局估计行
+        else {
+            const auto end = vlv.end() - 1;
+            const auto itr = std::find_if(vlv.begin(), end, is_estimated);
+            if (itr == end) break;
+            const auto first = itr->lineno;
+            const auto next = std::find_if_not(itr, end, is_estimated)->lineno;
+            if (!Private::FillVL(doc, first, std::min(next, first + step))) break;
+        }
+        progressed = true;
+        const auto now = clock::now();
+        const auto used = now - time;
+        time = now;
+        if (used > budget) step = std::max(step >> 1, uint32_t(LAYOUT_ASYNC_LINE));
+        else if (used * 2 < budget) step = std::min(step << 1, std::max(line_count, uint32_t(LAYOUT_ASYNC_LINE)));
+        if (now >= deadline) {
+            Private::ValueChanged(doc, Changed_LayoutPending);
+            break;
+        }
+    }
+    if (progressed) Private::ValueChanged(doc, Changed_LayoutAsync);
+    return progressed;
+}
+
+/// <summary>
+/// Lays out next lines on background thread.
+/// </summary>
+/// <param name="ctx">The document.</param>
+/// <returns>false if all lines laid out</returns>
+bool RichED::CEDTextDocument::Private::LayoutStep(void* ctx) noexcept {
+    using clock = std::chrono::steady_clock;
+    auto& doc = *static_cast<CEDTextDocument*>(ctx);
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return false;
+    const auto time = clock::now();
+    // 布局到末尾后再布局估计行
+    if (vlv[vlv.GetSize() - 1].first == &doc.m_tail && !Private::GapVL(doc)) return false;
+    const auto lineno = vlv[vlv.GetSize() - 1].lineno;
+    // 每步逻辑行数按耗时调整, 使一步约为LAYOUT_ASYNC_US, 暂停只需等待一步
+    // (单个逻辑行无法拆分, 超长逻辑行仍是一步)
+    auto& step = doc.m_uAsyncStep;
+    Private::ExpandVL(doc, lineno + step, max_unit());
+    const auto used = clock::now() - time;
+    const auto budget = std::chrono::microseconds(LAYOUT_ASYNC_US);
+    if (used > budget) step = std::max(step >> 1, uint32_t(1));
+    else if (used * 2 < budget) step = std::min(step << 1, std::max(doc.m_vLogic.GetSize(), uint32_t(1)));
+    if (vlv.IsFailed()) return false;
+    // 没有进展(如内存不足)时同样停止
+    return vlv[vlv.GetSize() - 1].lineno > lineno;
+}
+
+
+/// <summary>
+/// Lays out all rest lines in parallel.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="thread_count">The thread count.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ParallelVL(
+    CEDTextDocument& doc, uint32_t thread_count) noexcept {
+    auto& vlv = doc.m_vVisual;
+    if (vlv.IsFailed()) return;
+    const uint32_t count = vlv.GetSize() - 1;
+    const auto first = vlv[count].lineno;
+    // 已经处理完毕
+    if (vlv[count].first == &doc.m_tail) return;
+    const auto line_count = doc.m_vLogic.GetSize();
+    const auto rest = line_count - first;
+    // 行数较少时串行即可, 平台不支持并发调用时只能串行
+    thread_count = std::min(thread_count, uint32_t(LAYOUT_PARALLEL_THREAD));
+    if (!(doc.m_info.flags & Flag_ThreadSafePlatform)) thread_count = 1;
+    if (thread_count < 2 || rest < LAYOUT_PARALLEL_LINE * 2)
+        return Private::ExpandVL(doc, uint32_t(-1), max_unit());
+    // 后续干净视觉行一并重新布局
+    doc.m_uTailBegin = doc.m_uTailEnd = 0;
+    // 按逻辑行分块, 块数多于线程数以平衡负载
+    impl::layout_chunk chunks[LAYOUT_PARALLEL_CHUNK];
+    impl::layout_parallel ctx;
+    ctx.doc = &doc;
+    ctx.chunks = chunks;
+    ctx.first = first;
+    ctx.step = std::max((rest - 1) / LAYOUT_PARALLEL_CHUNK + 1, uint32_t(LAYOUT_PARALLEL_LINE));
+    ctx.count = (rest - 1) / ctx.step + 1;
+    ctx.next = 0;
+#ifndef NDEBUG
+    doc.platform.DebugOutput("<ParallelVL>", false);
+#endif // !NDEBUG
+    // 常驻线程池, 本线程同样参与
+    doc.m_pool.Run(Private::ParallelStep, &ctx, thread_count);
+    // 拼接各块视觉行
+    uint32_t total = count;
+    unit_t est_width = count ? doc.m_szEstimated.width : 0;
+    for (uint32_t i = 0; i != ctx.count; ++i) {
+        if (!chunks[i].ok) { Private::ResetVL(doc); return; }
+        total += chunks[i].lines.GetSize();
+        est_width = std::max(est_width, chunks[i].width);
+    }
+    if (!vlv.Resize(total + 1, doc.platform)) return;
+    auto itr = vlv.GetData() + count;
+    for (uint32_t i = 0; i != ctx.count; ++i) {
+        const auto size = chunks[i].lines.GetSize();
+        std::memcpy(itr, chunks[i].lines.GetData(), sizeof(VisualLine) * size);
+        itr += size;
+    }
+    *itr = chunks[ctx.count - 1].next;
+    assert(itr->first == &doc.m_tail);
+    // 偏移修正: 重建高度索引, 固定行高不需要
+    if (!Private::IsFixedLH(doc) &&
+        !doc.m_height.Rebuild(count, count, total + 1, vlv.GetData(), doc.platform)) {
+        Private::ResetVL(doc);
+        return;
+    }
+    doc.m_szEstimated.width = est_width;
+    doc.m_szEstimated.height = Private::OffsetVL(doc, total);
+}
+
+/// <summary>
+/// Lays out next chunk in parallel.
+/// </summary>
+/// <param name="ptr">The context.</param>
+/// <returns>false if no chunk left</returns>
+bool RichED::CEDTextDocument::Private::ParallelStep(void* ptr) noexcept {
+    auto& ctx = *static_cast<impl::layout_parallel*>(ptr);
+    const auto index = ctx.next.fetch_add(1);
+    if (index >= ctx.count) return false;
+    auto& doc = *ctx.doc;
+    auto& chunk = ctx.chunks[index];
+    const auto begin = ctx.first + index * ctx.step;
+    const auto end = std::min(begin + ctx.step, doc.m_vLogic.GetSize());
+    VisualLine line = { doc.m_vLogic[begin].first, begin, 0, 0, 0, 0, 0, 0 };
+    chunk.width = 0;
+    chunk.ok = chunk.lines.Reserve(end - begin + RED_INIT_ARRAY_BUFLEN, doc.platform);
+    const auto push = [&chunk, &doc](const VisualLine& vl) noexcept {
+        return impl::push_data(chunk.lines, vl, doc.platform);
+    };
+    // 各块CELL互不相交, 只有分裂合并时需要加锁
+    while (chunk.ok && line.lineno < end)
+        chunk.ok = Private::WrapLine(doc, line, chunk.width, push, ctx.mutex);
+    chunk.next = line;
+    return true;
+}
+
+/// <summary>
+/// Recreates the specified cell.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::Recreate(
+    CEDTextDocument&doc, CEDTextCell& cell) noexcept {
+    // 被注音的
+    if (cell.RefMetaInfo().metatype == Type_UnderRuby) {
+        // 第一次遍历: 重建检查是否重建
+        bool need_create = false;
+        const auto end_cell = [&cell, &need_create]() noexcept {
+            need_create = cell.RefMetaInfo().dirty;
+            auto node = impl::next_cell(&cell);
+            //assert(node->RefMetaInfo().metatype == Type_Ruby);
+            while (node->RefMetaInfo().metatype == Type_Ruby) {
+                need_create |= node->RefMetaInfo().dirty;
+                const auto eol = node->RefMetaInfo().eol;
+                node = impl::next_cell(node);
+                if (eol) break;
+            }
+            return node;
+        }();
+        if (!need_create) return;
         // 第二次遍历: 重建并检测宽度
         unit_t width = 0;
         {
@@ -2115,74 +3313,245 @@ bool RichED::CEDTextDocument::Private::Merge(
 /// <param name="doc">The document.</param>
 /// <param name="cell">The cell.</param>
 /// <param name="pos">The position.</param>
-/// <returns></returns>
-auto RichED::CEDTextDocument::Private::CheckWrap(
-    CEDTextDocument& doc, CEDTextCell& cell, unit_t pos) noexcept ->CEDTextCell* {
+/// <param name="bits">The break opportunities of logic line.</param>
+/// <param name="begin">The string offset of cell in logic line.</param>
+/// <param name="min">The min split position.</param>
+/// <returns>split position, 0 if wrap whole cell, length if none</returns>
+auto RichED::CEDTextDocument::Private::CheckWrap(CEDTextDocument& doc, CEDTextCell& cell,
+    unit_t pos, const uint32_t* bits, uint32_t begin, uint32_t min) noexcept ->uint32_t {
     const auto mode = doc.m_info.wrap_mode;
     const auto str = cell.RefString().data;
-    const auto len = cell.RefString().length;
+    const uint32_t len = cell.RefString().length;
+    if (min >= len) return len;
     switch (mode & 3)
     {
-        CellHitTest hittest; uint32_t index;
+        uint32_t index, end;
     case Mode_NoWrap:
         break;
     case Mode_SpaceOnly:
-        hittest = doc.platform.HitTest(cell, pos);
-        // 向前查找空格
-        index = hittest.pos;
-        while (index--) {
-            const auto ch = str[index];
-            if (ch == ' ') return cell.Split(index + 1);
-        }
-        // 向后查找空格
-        for (index = hittest.pos; index != len; ++index) {
-            const auto ch = str[index];
-            if (ch == ' ') return cell.Split(index + 1);
-        }
-        break;
     case Mode_SpaceOrCJK:
-        hittest = doc.platform.HitTest(cell, pos);
-        assert(hittest.pos < cell.RefString().length);
-        // 向前查找空格、CJK
-        index = hittest.pos;
-        do {
-            const auto this_index = index;
-            // 空格允许延后一个字符
-            const auto ch = str[this_index];
-            if (ch == ' ') return cell.Split(this_index);
-            // CJK需要提前一个字符
-            char32_t cjk; const auto lch = str[this_index - 1];
-            if (impl::is_2nd_surrogate(lch)) {
-                assert(index); --index;
-                const auto pch = str[this_index - 2];
-                assert(impl::is_1st_surrogate(pch));
-                cjk = impl::char16x2to32(pch, lch);
-            }
-            else cjk = static_cast<char32_t>(lch);
-            if (impl::is_cjk(cjk)) return cell.Split(this_index);
-        } while (index--);
-        // 向后查找空格、CJK
-        for (index = hittest.pos; index != len; ++index) {
-            const auto ch = str[index];
-            if (ch == ' ') return cell.Split(index + 1);
-            char32_t cjk;
-            if (impl::is_1st_surrogate(ch)) {
-                const auto nch = str[++index];
-                assert(impl::is_2nd_surrogate(nch));
-                cjk = impl::char16x2to32(ch, nch);
-            }
-            else cjk = static_cast<char32_t>(ch);
-            if (impl::is_cjk(cjk)) return cell.Split(index);
+        if (!bits) break;
+        index = doc.platform.HitTest(cell, pos).pos;
+        assert(index < len);
+        // 行末空格悬挂, 在空格之后换行
+        for (end = index; end != len && str[end] == ' '; ++end);
+        if (end != index && end != len && bits[(begin + end) >> 5] & (uint32_t(1) << ((begin + end) & 31)))
+            return end;
+        // 向前查找断行机会
+        if (index >= min) {
+            const auto found = FindBitBackward(bits, begin + min, begin + index + 1);
+            if (found != begin + index + 1) return found - begin;
         }
-        break;
+        // 向后查找断行机会
+        index = std::max(index + 1, min);
+        return FindBitForward(bits, begin + index, begin + len) - begin;
     case Mode_Anywhere:
-        hittest = doc.platform.HitTest(cell, pos);
-        // 此处中断
-        return cell.Split(hittest.pos);
+        // 此处中断, 不拆分代理对
+        index = std::max(doc.platform.HitTest(cell, pos).pos, min);
+        if (index < len && impl::is_2nd_surrogate(str[index])) ++index;
+        return std::min(index, len);
+    }
+    return len;
+}
+
+/// <summary>
+/// Finds break opportunities of logic line in wrap cache.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="lineno">The logic line.</param>
+/// <returns>bit set if break allowed before char, nullptr if none</returns>
+auto RichED::CEDTextDocument::Private::FindBreak(
+    const CEDTextDocument& doc, uint32_t lineno) noexcept -> const uint32_t* {
+    if (lineno >= doc.m_vLogic.GetSize()) return nullptr;
+    const auto offset = doc.m_vLogic[lineno].wrap;
+    if (!offset) return nullptr;
+    const auto record = doc.m_vWrap.begin() + offset;
+    return record[1] ? record + 2 : nullptr;
+}
+
+/// <summary>
+/// Computes break opportunities of logic line.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="first">The first cell of logic line.</param>
+/// <param name="words">The word count of bits.</param>
+/// <param name="bits">The bits, set if break allowed before char.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::LineBreaks(const CEDTextDocument& doc,
+    const CEDTextCell& first, uint32_t words, uint32_t* bits) noexcept {
+    std::memset(bits, 0, sizeof(uint32_t) * words);
+    CEDLineBreaker breaker{ (doc.m_info.wrap_mode & 3) == Mode_SpaceOnly };
+    uint32_t offset = 0;
+    // 逻辑行内一次线性遍历
+    for (auto cell = &first; ; cell = impl::next_cell(cell)) {
+        const auto& str = cell->RefString();
+        assert(((offset + str.length) >> 5) < words);
+        // 内联对象前后均可断行
+        if (cell->RefMetaInfo().metatype >= Type_InlineObject) {
+            if (breaker.Feed(LB_CB)) bits[offset >> 5] |= uint32_t(1) << (offset & 31);
+        }
+        else breaker.Feed(str.data, str.length, bits, offset);
+        offset += str.length;
+        if (cell->RefMetaInfo().eol) break;
+    }
+}
+
+
+/// <summary>
+/// Finds the wrap cache of logic line for current viewport width.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="lineno">The logic line.</param>
+/// <returns>[count, breaks...], nullptr if none</returns>
+auto RichED::CEDTextDocument::Private::FindWrap(
+    const CEDTextDocument& doc, uint32_t lineno) noexcept -> const uint32_t* {
+    static_assert(sizeof(unit_t) == sizeof(uint32_t), "same size");
+    if (lineno >= doc.m_vLogic.GetSize()) return nullptr;
+    const auto offset = doc.m_vLogic[lineno].wrap;
+    if (!offset) return nullptr;
+    uint32_t width; std::memcpy(&width, &doc.m_rcViewport.width, sizeof(width));
+    // [n][m][断行机会 * m] [宽度][数量][断点...] * n
+    const auto record = doc.m_vWrap.begin() + offset;
+    auto entry = record + 2 + record[1];
+    for (uint32_t i = 0; i != record[0]; ++i) {
+        if (entry[0] == width) return entry + 1;
+        entry += 2 + entry[1];
     }
     return nullptr;
 }
 
+/// <summary>
+/// Saves the wrap cache of logic line for current viewport width.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="lineno">The logic line.</param>
+/// <param name="bits">The break opportunities, null to keep cached.</param>
+/// <param name="breaks">The break positions.</param>
+/// <param name="count">The break count, only opportunities saved if too many.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::SaveWrap(CEDTextDocument& doc,
+    uint32_t lineno, const uint32_t* bits, const uint32_t* breaks, uint32_t count) noexcept {
+    if (lineno >= doc.m_vLogic.GetSize()) return;
+    // 保留最近的几个宽度, 旧记录留在原处等待压缩
+    auto old = doc.m_vLogic[lineno].wrap;
+    // 断行机会不需要时(任意处换行)为空
+    auto words = bits ? impl::break_words(doc.m_vLogic[lineno].length) : 0;
+    const bool add = count <= WRAP_CACHE_BREAK;
+    uint32_t drop = 0, keep = 0;
+    if (old) {
+        const auto record = doc.m_vWrap.begin() + old;
+        if (!bits) words = record[1];
+        const auto n = record[0];
+        drop = add && n >= WRAP_CACHE_WIDTH ? n - (WRAP_CACHE_WIDTH - 1) : 0;
+        auto entry = record + 2 + record[1];
+        for (uint32_t i = 0; i != n; ++i) {
+            const auto size = 2 + entry[1];
+            if (i >= drop) keep += size;
+            entry += size;
+        }
+    }
+    if (!add && !bits) return;
+    const uint32_t need = 2 + words + keep + (add ? 2 + count : 0);
+    if (!Private::ReserveWrap(doc, need)) return;
+    // 压缩后位置可能改变
+    old = doc.m_vLogic[lineno].wrap;
+    auto& buf = doc.m_vWrap;
+    const auto base = buf.GetSize();
+    buf.ExpandSize(base + need);
+    const auto data = buf.GetData();
+    auto dst = data + base;
+    dst[0] = 0;
+    dst[1] = words;
+    if (words) std::memcpy(dst + 2, bits ? bits : data + old + 2, sizeof(uint32_t) * words);
+    dst += 2 + words;
+    if (old) {
+        auto entry = data + old + 2 + data[old + 1];
+        for (uint32_t i = 0; i != data[old]; ++i) {
+            const auto size = 2 + entry[1];
+            if (i >= drop) {
+                std::memcpy(dst, entry, sizeof(uint32_t) * size);
+                dst += size;
+                ++data[base];
+            }
+            entry += size;
+        }
+    }
+    if (add) {
+        std::memcpy(dst, &doc.m_rcViewport.width, sizeof(uint32_t));
+        dst[1] = count;
+        std::memcpy(dst + 2, breaks, sizeof(uint32_t) * count);
+        ++data[base];
+    }
+    doc.m_vLogic[lineno].wrap = base;
+}
+
+/// <summary>
+/// Reserves space in wrap cache, compact live records if full.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="len">The length needed.</param>
+/// <returns>false if out of memory, cache will be cleared</returns>
+bool RichED::CEDTextDocument::Private::ReserveWrap(CEDTextDocument& doc, uint32_t len) noexcept {
+    auto& buf = doc.m_vWrap;
+    // 0号位置表示没有记录
+    if (!buf.GetSize()) {
+        if (!buf.Reserve(std::max(len + 1, uint32_t(RED_INIT_ARRAY_BUFLEN)), doc.platform)) {
+            Private::ClearWrap(doc);
+            return false;
+        }
+        buf.ExpandSize(1);
+        buf[0] = 0;
+    }
+    if (buf.GetSize() + len <= buf.GetCapacity()) return true;
+    // 统计存活记录
+    auto& lines = doc.m_vLogic;
+    const auto line_count = lines.GetSize();
+    uint32_t live = 1;
+    for (uint32_t i = 0; i != line_count; ++i)
+        if (const auto offset = lines[i].wrap)
+            live += impl::wrap_record_size(buf.begin() + offset);
+    const auto capacity = std::max({
+        (live + len) * 2, line_count / 8 + len, uint32_t(RED_INIT_ARRAY_BUFLEN) });
+    // 压缩至临时缓存后拷贝回来
+    CEDBuffer<uint32_t> temp;
+    if (!temp.Reserve(live, doc.platform)) {
+        Private::ClearWrap(doc);
+        return false;
+    }
+    temp.ExpandSize(live);
+    const auto dst = temp.GetData();
+    uint32_t pos = 1; dst[0] = 0;
+    for (uint32_t i = 0; i != line_count; ++i) {
+        auto& line = lines[i];
+        if (!line.wrap) continue;
+        const auto src = buf.begin() + line.wrap;
+        const auto size = impl::wrap_record_size(src);
+        std::memcpy(dst + pos, src, sizeof(uint32_t) * size);
+        line.wrap = pos;
+        pos += size;
+    }
+    assert(pos == live);
+    if (!buf.Reserve(capacity, doc.platform)) {
+        Private::ClearWrap(doc);
+        return false;
+    }
+    std::memcpy(buf.GetData(), dst, sizeof(uint32_t) * live);
+    buf.ReduceSize(live);
+    return true;
+}
+
+/// <summary>
+/// Clears the wrap cache.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ClearWrap(CEDTextDocument& doc) noexcept {
+    doc.m_vWrap.Clear();
+    auto& lines = doc.m_vLogic;
+    const auto count = lines.GetSize();
+    for (uint32_t i = 0; i != count; ++i) lines[i].wrap = 0;
+}
+
 
 /// <summary>
 /// Sets the selection.
@@ -2321,7 +3690,7 @@ bool RichED::CEDTextDocument::Private::Insert(
     // 遍历到合适的位置
     impl::find_cell1_txtoff_ex(cell, pos);
     // 这之后的为脏
-    Private::Dirty(doc, *cell, dp.line);
+    Private::Dirty(doc, dp.line);
 
     CellType insert_type = Type_Normal;
 
@@ -2338,9 +3707,12 @@ bool RichED::CEDTextDocument::Private::Insert(
         if (behind && !cell->RefMetaInfo().eol) {
             // 插入最后面
             if (cell->next == &doc.m_tail) {
-                const auto obj = RichED::CreateNormalCell(doc, doc.default_riched);
+                const auto style = Private::DefaultStyle(doc);
+                if (style == TEXT_STYLE_INVALID) return false;
+                const auto obj = RichED::CreateNormalCell(doc, style,
+                    static_cast<uint32_t>(view.second - view.first));
                 if (!obj) return false;
-                RichED::InsertAfterFirst(*cell, *obj);
+                RichED::InsertCellAfter(*cell, *obj);
             }
             cell = impl::next_cell(cell);
             pos = 0; 
@@ -2358,29 +3730,26 @@ bool RichED::CEDTextDocument::Private::Insert(
     // 设置插入文字的格式. 注: 不要引用, 防止引用失效
     // 1. 通常: CELL自带格式
     // 2. 其他: 默认格式?
-    const auto riched = *([=, &doc]() noexcept {
-        return &cell->RefRichED();
-        //return &doc.default_riched;
-    }()); 
+    const auto style = [=, &doc]() noexcept {
+        return cell->GetStyle();
+        //return Private::DefaultStyle(doc);
+    }(); 
 
 
 
     // 第一次遍历, 为m_vLogic创建空间
     const auto lf_count = impl::lfcount(view).line;
     if (lf_count) {
-        const size_t moved = sizeof(LogicLine) * (doc.m_vLogic.GetSize() - dp.line - 1);
-        const auto ns = doc.m_vLogic.GetSize() + lf_count;
-        if (!doc.m_vLogic.Resize(ns, doc.platform)) return false;
-        const auto ptr = doc.m_vLogic.GetData();
-        const auto base = ptr + dp.line;
-        // [insert+1, prev_end) MOVETO [insert+1+lfcount, END)
-        std::memmove(base + lf_count + 1, base + 1, moved);
+        // 间隙移动到插入点, 插入的行与当前行连续
+        if (!doc.m_vLogic.Insert(dp.line + 1, lf_count, doc.platform)) return false;
+        Private::ShiftVL(doc, dp.line + 1, int32_t(lf_count));
         for (uint32_t i = 0; i != lf_count; ++i)
-            base[i] = { linedata.first, 0 };
+            doc.m_vLogic[dp.line + i] = { linedata.first, 0, 0 };
         // 初始化行信息
         const uint32_t left = linedata.length - dp.pos;
-        base[0].length = dp.pos;
-        base[lf_count].length = left;
+        doc.m_vLogic[dp.line].length = dp.pos;
+        doc.m_vLogic[dp.line + lf_count].length = left;
+        doc.m_vLogic[dp.line + lf_count].wrap = 0;
     }
 
 
@@ -2394,14 +3763,24 @@ bool RichED::CEDTextDocument::Private::Insert(
 
 
     // 优化: 足够塞进去的话
-    auto line_ptr = &doc.m_vLogic[dp.line];
+    // 逻辑行按索引访问, 不假定间隙缓冲中行连续
+    auto& lines = doc.m_vLogic;
+    auto line_no = dp.line;
     if (!lf_count) {
         // TODO: 插入双字UTF-16?
         const auto len = static_cast<int32_t>(view.second - view.first);
+        // 容量不够则尝试扩容, CELL可能被移动
+        if (len > cell->RefString().Left()) {
+            const auto old_cell = cell;
+            if (const auto obj = cell->Reserve(len)) {
+                if (lines[line_no].first == old_cell) lines[line_no].first = obj;
+                cell = obj;
+            }
+        }
         if (len <= cell->RefString().Left()) {
             cell->InsertText(pos, view);
-            line_ptr->length += add_total(len);
-            Private::Dirty(doc, *cell, dp.line);
+            lines[line_no].length += add_total(len);
+            Private::Dirty(doc, dp.line);
             on_success();
             return true;
         }
@@ -2426,15 +3805,19 @@ bool RichED::CEDTextDocument::Private::Insert(
     // 3. 中间剩余的部分(可能不存在)
 
     CEDTextCell* cell_a, *cell_b;
-    Node** pointer_to_the_first_at_line = &line_ptr->first->prev->next;
+    Node** pointer_to_the_first_at_line = &lines[line_no].first->prev->next;
 
     // 前面
     if (pos == 0) {
-        cell_a = RichED::CreateNormalCell(doc, riched);
+        // 容量参考第一行长度
+        auto first_view = view;
+        const auto first_line = impl::lfview(first_view);
+        const auto first_len = first_line.second - first_line.first;
+        cell_a = RichED::CreateNormalCell(doc, style, static_cast<uint32_t>(first_len));
         if (!cell_a) return false;
         cell_b = cell;
         const auto prev_cell = static_cast<CEDTextCell*>(cell_b->prev);
-        RichED::InsertAfterFirst(*prev_cell, *cell_a);
+        RichED::InsertCellAfter(*prev_cell, *cell_a);
     }
     // 细胞分裂
     else {
@@ -2448,10 +3831,9 @@ bool RichED::CEDTextDocument::Private::Insert(
     const auto view1 = impl::nice_view1(view, cell_a->RefString().Left());
     const auto view2 = impl::nice_view2(view, cell_b->RefString().Left());
 
-    line_ptr[0].first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);;
-    line_ptr[0].length += add_total(view1.second - view1.first);
-    line_ptr[lf_count].length += add_total(view2.second - view2.first);
-    const auto old_line_ptr = line_ptr;
+    lines[line_no].first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);
+    lines[line_no].length += add_total(view1.second - view1.first);
+    lines[line_no + lf_count].length += add_total(view2.second - view2.first);
     cell_a->InsertText(pos, view1);
     cell_b->InsertText(0, view2);
     cell = cell_a;
@@ -2465,7 +3847,7 @@ bool RichED::CEDTextDocument::Private::Insert(
             // 获取新的一行字符数据
             auto line_view = impl::lfview(view);
             // 有效字符串 --- XA
-            if (line_view.first != line_view.second || line_ptr != old_line_ptr) do {
+            if (line_view.first != line_view.second || line_no != dp.line) do {
                 // 将有效字符串拆分成最大长度的字符串块
                 auto this_end = line_view.first + TEXT_CELL_STR_MAXLEN;
                 // 越界
@@ -2473,27 +3855,28 @@ bool RichED::CEDTextDocument::Private::Insert(
                 // 双字检查
                 if (impl::is_1st_surrogate(this_end[-1])) ++this_end;
                 // 创建CELL
-                const auto obj = RichED::CreateNormalCell(doc, riched);
+                const auto obj = RichED::CreateNormalCell(doc, style,
+                    static_cast<uint32_t>(this_end - line_view.first));
                 // TODO: 强异常保证
                 if (!obj) return false;
                 // 插入数据
                 const_cast<CellMeta&>(obj->RefMetaInfo()).metatype = insert_type;
-                line_ptr->length += add_total(this_end - line_view.first);
+                lines[line_no].length += add_total(this_end - line_view.first);
                 obj->InsertText(0, { line_view.first, this_end });
-                RichED::InsertAfterFirst(*cell, *obj);
+                RichED::InsertCellAfter(*cell, *obj);
                 cell = obj;
                 line_view.first = this_end;
             } while (line_view.first < line_view.second);
             // 行数据
-            line_ptr->first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);
+            lines[line_no].first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);
             pointer_to_the_first_at_line = &cell->next;
-            ++line_ptr;
+            ++line_no;
             if (view.first == view.second) break;
             cell->AsEOL();
         }
         // 最后一个换行
         if (view.second[-1] == '\n') {
-            line_ptr->first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);
+            lines[line_no].first = static_cast<CEDTextCell*>(*pointer_to_the_first_at_line);
             cell->AsEOL();
         }
     }
@@ -2541,12 +3924,12 @@ bool RichED::CEDTextDocument::Private::Insert(
 
     auto insert_after_this = cell;
     // 这之后的为脏
-    Private::Dirty(doc, *cell, dp.line);
+    Private::Dirty(doc, dp.line);
     auto const next_is_first = line_data.first->prev;
 
     if (pos == 0) insert_after_this = static_cast<CEDTextCell*>(cell->prev);
     else if (pos < cell->RefString().length) if (!cell->Split(pos)) return false;
-    RichED::InsertAfterFirst(*insert_after_this, obj);
+    RichED::InsertCellAfter(*insert_after_this, obj);
 
     line_data.first = impl::next_cell(next_is_first);
     // 添加总长度
@@ -2705,12 +4088,12 @@ void RichED::CEDTextDocument::Private::RecordRich(
     //    return;
     // 计算不同的富属性多少个
     uint32_t count = 1;
-    auto riched = &cell1->RefRichED();
+    auto style = cell1->GetStyle();
     const auto cfor = impl::cfor_cells(cell1, cell2);
     for (auto& cell : cfor) {
         auto& real_cell = *impl::next_cell(&cell);
-        if (real_cell.RefString().length && real_cell.RefRichED() != *riched) {
-            riched = &real_cell.RefRichED();
+        if (real_cell.RefString().length && real_cell.GetStyle() != style) {
+            style = real_cell.GetStyle();
             ++count;
         }
     }
@@ -2736,7 +4119,7 @@ void RichED::CEDTextDocument::Private::RecordRich(
     // 遍历
     auto end = begin; uint32_t index = 0;
     auto start = pos1;
-    riched = &cell1->RefRichED();
+    style = cell1->GetStyle();
     for (auto& cell : cfor) {
         // 换行
         end.pos += cell.RefString().length - start;
@@ -2744,18 +4127,18 @@ void RichED::CEDTextDocument::Private::RecordRich(
         if (cell.RefMetaInfo().eol) { end.line++; end.pos = 0; }
 
         auto& real_cell = *impl::next_cell(&cell);
-        // 新的格式
-        if (real_cell.RefRichED() != *riched) {
-            impl::rich_set(data, index, *riched, begin, end);
+        // 新的格式: 与计数时一致, 跳过空CELL
+        if (real_cell.RefString().length && real_cell.GetStyle() != style) {
+            impl::rich_set(data, index, style, begin, end);
             begin = end;
-            riched = &real_cell.RefRichED();
+            style = real_cell.GetStyle();
             ++index;
         }
     }
     // 最后一个
     end.pos += pos2 - start;
     assert(index < count);
-    impl::rich_set(data, index, *riched, begin, end);
+    impl::rich_set(data, index, style, begin, end);
     // 添加
     const auto op = reinterpret_cast<TrivialUndoRedo*>(data);
     doc.m_undo.AddOp(doc, *op);
@@ -2817,19 +4200,19 @@ void RichED::CEDTextDocument::Private::AllocUndoFailed(CEDTextDocument & doc) no
 /// </summary>
 /// <param name="doc">The document.</param>
 /// <param name="begin">The begin.</param>
-/// <param name="riched">The riched.</param>
+/// <param name="style">The style.</param>
 /// <param name="ch">The ch.</param>
 /// <param name="view">The view.</param>
 /// <returns></returns>
 void RichED::CEDTextDocument::Private::RecordRubyEx(
-    CEDTextDocument & doc, DocPoint begin, const RichData & riched, char32_t ch, U16View view) noexcept {
+    CEDTextDocument & doc, DocPoint begin, uint16_t style, char32_t ch, U16View view) noexcept {
     // 申请数据
     const auto len = static_cast<uint32_t>(view.second - view.first);
     const auto data = doc.Alloc(impl::ruby_undoredo_len(len));
     if (!data) return Private::AllocUndoFailed(doc);
     impl::ruby_undoredo_mk(data, len);
     impl::ruby_as_insert(data, doc.m_uUndoOp++);
-    impl::ruby_set_data(data, begin, ch, view, riched);
+    impl::ruby_set_data(data, begin, ch, view, style);
     const auto op = reinterpret_cast<TrivialUndoRedo*>(data);
     doc.m_undo.AddOp(doc, *op);
 }
@@ -2920,7 +4303,7 @@ bool RichED::CEDTextDocument::Private::RemoveText(
     // 需要重绘
     Private::NeedRedraw(doc);
     // 标记为脏
-    Private::Dirty(doc, *cell1, begin.line);
+    Private::Dirty(doc, begin.line);
     // 处理
     const auto cell2_next = impl::next_cell(cell2);
     bool delete_eol = false;
@@ -2958,10 +4341,12 @@ bool RichED::CEDTextDocument::Private::RemoveText(
         // 从头删除
         if (begin.pos == 0) {
             // 重新创建一个CELL作为
-            const auto ptr = RichED::CreateNormalCell(doc, doc.default_riched);
+            const auto style = Private::DefaultStyle(doc);
+            const auto ptr = style == TEXT_STYLE_INVALID ? nullptr
+                : RichED::CreateNormalCell(doc, style, 0);
             // TODO: 错误处理
             if (!ptr) return false;
-            RichED::InsertAfterFirst(*node, *ptr);
+            RichED::InsertCellAfter(*node, *ptr);
             node = ptr;
         }
         node->AsEOL();
@@ -2975,13 +4360,9 @@ bool RichED::CEDTextDocument::Private::RemoveText(
     line_data1.first = impl::next_cell(next_is_first_to_line_1);
     // 合并逻辑行
     if (begin.line != end.line) {
-        auto& llv = doc.m_vLogic;
-        const auto len = llv.GetSize();
-        assert(len > end.line);
-        const auto ptr = llv.GetData();
-        const auto bsize = sizeof(ptr[0]) * (len - end.line - 1);
-        std::memmove(ptr + begin.line + 1, ptr + end.line + 1, bsize);
-        llv.ReduceSize(len + begin.line - end.line);
+        assert(doc.m_vLogic.GetSize() > end.line);
+        doc.m_vLogic.Remove(begin.line + 1, end.line - begin.line);
+        Private::ShiftVL(doc, begin.line + 1, int32_t(begin.line - end.line));
     }
     on_success();
     return true;
@@ -3007,23 +4388,233 @@ void RichED::CEDTextDocument::Private::CheckEstimated(CEDTextDocument& doc) noex
     Private::ValueChanged(doc, flag);
 }
 
+/// <summary>
+/// Dirties the end logic lines of style range whose cell was split.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="first">The first logic line.</param>
+/// <param name="last">The last logic line.</param>
+/// <param name="split_first">if set to <c>true</c> [cell split in first line].</param>
+/// <param name="split_last">if set to <c>true</c> [cell split in last line].</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::DirtySplit(CEDTextDocument& doc,
+    uint32_t first, uint32_t last, bool split_first, bool split_last) noexcept {
+    // 分裂出的CELL在布局时重建, 两端都分裂时一并标记: 分开标记会丢弃后续干净行
+    if (split_first && split_last) Private::Dirty(doc, first, last - first + 1);
+    else if (split_first) Private::Dirty(doc, first);
+    else if (split_last) Private::Dirty(doc, last);
+    Private::NeedRedraw(doc);
+}
+
 /// <summary>
 /// Dirties the specified document.
 /// </summary>
 /// <param name="doc">The document.</param>
-/// <param name="cell">The cell.</param>
 /// <param name="logic_line">The logic line.</param>
+/// <param name="line_count">The logic line count.</param>
 /// <returns></returns>
-void RichED::CEDTextDocument::Private::Dirty(CEDTextDocument& doc, CEDTextCell& cell, uint32_t logic_line) noexcept {
+void RichED::CEDTextDocument::Private::Dirty(CEDTextDocument& doc,
+    uint32_t logic_line, uint32_t line_count) noexcept {
     auto& vlv = doc.m_vVisual;
     const auto size = vlv.GetSize();
-    assert(size);
+    assert(size && line_count);
+    const auto line_end = logic_line + line_count;
+    // 换行缓存失效
+    const auto wrap_end = std::min(line_end, doc.m_vLogic.GetSize());
+    for (auto i = logic_line; i < wrap_end; ++i) doc.m_vLogic[i].wrap = 0;
+    // 已经保留了后续干净视觉行
+    if (doc.m_uTailBegin != doc.m_uTailEnd) {
+        const auto data = vlv.GetData();
+        const auto delta = doc.m_iTailDelta;
+        const auto tail_b = data + doc.m_uTailBegin;
+        const auto tail_e = data + doc.m_uTailEnd;
+        const uint32_t tail_line = tail_b->lineno + delta;
+        // 在后续干净行内: 截断于此
+        if (logic_line >= tail_line) {
+            const auto itr = RichED::LowerVL(tail_b, tail_e, logic_line - delta);
+            if (itr != tail_e) doc.m_uTailEnd = uint32_t(itr - data) + 1;
+            return;
+        }
+        // 在脏行内: 可能需要去掉后续干净行的前面部分
+        if (logic_line >= vlv[size - 1].lineno) {
+            if (line_end > tail_line) {
+                const auto itr = RichED::LowerVL(tail_b, tail_e, line_end - delta);
+                if (itr == tail_e) doc.m_uTailBegin = doc.m_uTailEnd = 0;
+                else doc.m_uTailBegin = uint32_t(itr - data);
+            }
+            return;
+        }
+        // 在前面: 放弃保留
+        doc.m_uTailBegin = doc.m_uTailEnd = 0;
+    }
     // 大概率在编辑第一行, 直接返回
     if (size < 2) return;
-    // 利用二分查找到第一个, 然后, 删掉后面的
+    // 利用二分查找到第一个
     const auto itr = RichED::LowerVL(vlv.begin(), vlv.end(), logic_line);
     const uint32_t index = itr - vlv.begin();
-    if (index < size) vlv.ReduceSize(index + 1);
+    if (index + 1 >= size) return;
+    // 之后的逻辑行保留在缓存末尾, 重新布局到那里时直接接上
+    const auto tail = RichED::LowerVL(itr, vlv.end(), line_end);
+    if (tail != vlv.end()) {
+        doc.m_uTailBegin = uint32_t(tail - vlv.begin());
+        doc.m_uTailEnd = size;
+        doc.m_iTailDelta = 0;
+        doc.m_uTailGrow = 0;
+    }
+    vlv.ReduceSize(index + 1);
+}
+
+/// <summary>
+/// Logic lines inserted[delta > 0] or removed[delta < 0] at line.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="line">The line.</param>
+/// <param name="delta">The delta.</param>
+/// <returns></returns>
+void RichED::CEDTextDocument::Private::ShiftVL(
+    CEDTextDocument& doc, uint32_t line, int32_t delta) noexcept {
+    if (doc.m_uTailBegin == doc.m_uTailEnd) return;
+    const auto data = doc.m_vVisual.GetData();
+    const auto tail_b = data + doc.m_uTailBegin;
+    const auto tail_e = data + doc.m_uTailEnd;
+    const uint32_t tail_line = tail_b->lineno + doc.m_iTailDelta;
+    // 在后续干净行内: 截断于此, 这一行起点不变
+    if (line > tail_line) {
+        const auto itr = RichED::LowerVL(tail_b, tail_e, line - doc.m_iTailDelta);
+        if (itr != tail_e) doc.m_uTailEnd = uint32_t(itr - data) + 1;
+        return;
+    }
+    // 删除了后续干净行的前面部分
+    if (delta < 0 && line - delta > tail_line) {
+        const auto itr = RichED::LowerVL(tail_b, tail_e, line - delta - doc.m_iTailDelta);
+        if (itr == tail_e) {
+            doc.m_uTailBegin = doc.m_uTailEnd = 0;
+            return;
+        }
+        doc.m_uTailBegin = uint32_t(itr - data);
+    }
+    doc.m_iTailDelta += delta;
+}
+
+/// <summary>
+/// Pushes the visual line.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="line">The line.</param>
+/// <returns></returns>
+bool RichED::CEDTextDocument::Private::PushVL(
+    CEDTextDocument& doc, const VisualLine& line) noexcept {
+    auto& vlv = doc.m_vVisual;
+    const auto size = vlv.GetSize();
+    if (doc.m_uTailBegin == doc.m_uTailEnd) {
+        if (!impl::push_data(vlv, line, doc.platform)) return false;
+    }
+    else {
+        // 碰到后续干净视觉行: 后移, 间隙从1开始成倍增长, 多出一行时只移动这一次
+        if (size == doc.m_uTailBegin) {
+            const auto move = doc.m_uTailGrow = doc.m_uTailGrow ? doc.m_uTailGrow * 2 : 1;
+            const auto need = doc.m_uTailEnd + move;
+            if (need > vlv.GetCapacity() &&
+                !vlv.Reserve(need + (doc.m_uTailEnd >> 1), doc.platform)) {
+                doc.m_uTailBegin = doc.m_uTailEnd = 0;
+                return false;
+            }
+            const auto data = vlv.GetData();
+            const auto count = doc.m_uTailEnd - doc.m_uTailBegin;
+            const auto src = data + doc.m_uTailBegin;
+            const auto delta = doc.m_iTailDelta;
+            // 后移时顺带修正行号, 拼接时就不用再遍历一次
+            if (delta) {
+                for (auto i = count; i--; ) {
+                    src[i + move] = src[i];
+                    src[i + move].lineno += delta;
+                }
+                doc.m_iTailDelta = 0;
+            }
+            else std::memmove(src + move, src, sizeof(VisualLine) * count);
+            doc.m_uTailBegin += move;
+            doc.m_uTailEnd += move;
+            // 间隙高度为0
+            if (!Private::IsFixedLH(doc) &&
+                !doc.m_height.Rebuild(size, doc.m_uTailBegin, doc.m_uTailEnd, data, doc.platform)) {
+                Private::ResetVL(doc);
+                return false;
+            }
+        }
+        vlv.ExpandSize(size + 1);
+        vlv[size] = line;
+    }
+    // 更新高度索引, 固定行高不需要
+    if (Private::IsFixedLH(doc)) return true;
+    const auto height = line.ar_height_max + line.dr_height_max;
+    if (doc.m_height.Set(size, height, doc.platform)) return true;
+    Private::ResetVL(doc);
+    return false;
+}
+
+/// <summary>
+/// Finds the max count of visual lines that offset &lt;= y.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="y">The y, &gt;= 0.</param>
+/// <returns></returns>
+auto RichED::CEDTextDocument::Private::FindVL(
+    const CEDTextDocument& doc, unit_t y) noexcept -> uint32_t {
+    assert(y >= 0);
+    // 固定行高: 直接相除
+    if (Private::IsFixedLH(doc)) {
+        const auto size = doc.m_vVisual.GetSize();
+        const auto index = y / doc.m_info.fixed_lineheight;
+        return index < unit_t(size) ? uint32_t(index) : size;
+    }
+    return doc.m_height.Find(y);
+}
+
+/// <summary>
+/// Splices clean visual lines after the line.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="line">The first visual line of the logic line.</param>
+/// <returns></returns>
+bool RichED::CEDTextDocument::Private::SpliceVL(
+    CEDTextDocument& doc, const VisualLine& line) noexcept {
+    auto& vlv = doc.m_vVisual;
+    const auto size = vlv.GetSize();
+    const auto data = vlv.GetData();
+    const auto begin = doc.m_uTailBegin;
+    const auto count = doc.m_uTailEnd - begin;
+    const auto delta = doc.m_iTailDelta;
+    // 最后一个是起点, 其CELL可能已经失效
+    assert(count == 1 || data[begin].first == line.first);
+    assert(data[begin].char_len_before == 0);
+    doc.m_uTailBegin = doc.m_uTailEnd = 0;
+    // 视觉行数量不变时位置不变, 高度索引中只有修改过的需要更新
+    if (begin != size) {
+        // 前移与行号修正合并为一次遍历
+        if (delta) {
+            for (uint32_t i = 0; i != count; ++i) {
+                data[size + i] = data[begin + i];
+                data[size + i].lineno += delta;
+            }
+        }
+        else std::memmove(data + size, data + begin, sizeof(VisualLine) * count);
+        if (!Private::IsFixedLH(doc) &&
+            !doc.m_height.Rebuild(size, size, size + count, data, doc.platform)) {
+            Private::ResetVL(doc);
+            return false;
+        }
+    }
+    // 只有行数变化时才需要修改
+    else if (delta) {
+        for (auto itr = data + size; itr != data + size + count; ++itr)
+            itr->lineno += delta;
+    }
+    vlv.ExpandSize(size + count);
+    data[size].first = line.first;
+    // 最后一个作为之后的起点, 其CELL同样可能已经失效(合并或者扩容时移动)
+    auto& last = data[size + count - 1];
+    if (last.lineno < doc.m_vLogic.GetSize()) last.first = doc.m_vLogic[last.lineno].first;
+    return true;
 }
 
 /// <summary>
@@ -3068,7 +4659,8 @@ bool RichED::CEDTextDocument::Private::CheckRange(
             impl::find_cell1_txtoff_ex(cell2, pos2);
             assert(cell1 != cell2 || pos1 != pos2);
             // 删除无效区间
-            if (impl::is_2nd_surrogate(cell1->RefString().data[pos1])) return false;
+            if (pos1 < cell1->RefString().length)
+                if (impl::is_2nd_surrogate(cell1->RefString().data[pos1])) return false;
             if (pos2 < cell2->RefString().length)
                 if (impl::is_2nd_surrogate(cell2->RefString().data[pos2])) return false;
             ctx.begin = { cell1, pos1 };
@@ -3095,15 +4687,18 @@ bool RichED::CEDTextDocument::Private::HitTest(
     auto& vlv = doc.m_vVisual;
     // 最后一行是无效数据
     if (vlv.GetSize() < 2) return false;
-    // TODO: 固定行高模式
-    if (doc.m_info.flags & Flag_FixedLineHeight) {
-        assert(!"NOT IMPL");
-        return false;
+    // 找到指定视觉行: itr为第一个偏移量大于pos.y的
+    const uint32_t index = pos.y < 0 ? 0 : Private::FindVL(doc, pos.y) + 1;
+    const auto itr = vlv.begin() + std::min(index, vlv.GetSize());
+    // 估计行需要先布局
+    if (itr != vlv.begin()) {
+        const auto& vl = itr[itr == vlv.end() ? -2 : -1];
+        if (vl.estimated) {
+            if (!Private::FillVL(doc, vl.lineno, vl.lineno + 1)) return false;
+            return Private::HitTest(doc, pos, ctx);
+        }
     }
-    // 二分查找到指定视觉行
-    
-    const auto cmp = [](unit_t ll, const VisualLine& vl) noexcept { return  ll < vl.offset; };
-    const auto itr = std::upper_bound(vlv.begin(), vlv.end(), pos.y, cmp);
+    Private::AlignVL(doc, itr[itr == vlv.begin() ? 0 : itr == vlv.end() ? -2 : -1]);
     // 太高的话算第一行
     if (itr == vlv.begin()) {
         ctx.visual_line = &itr[0];
@@ -3126,7 +4721,7 @@ bool RichED::CEDTextDocument::Private::HitTest(
     // 正常情况下, itr指向的是下一行. 比如: [0, 20, 40]中, 输入10输出指向20
     constexpr int offset = -1;
     // 获取指定信息
-    const auto& line0 = itr[offset];
+    auto& line0 = itr[offset];
     ctx.visual_line = &line0;
     const auto& line1 = itr[offset + 1];
     const auto last = static_cast<CEDTextCell*>(line1.first->prev);
@@ -3140,22 +4735,20 @@ bool RichED::CEDTextDocument::Private::HitTest(
             - ctx.pos_in_cell
             ;
     }
-    // 遍历到指定位置
+    // 遍历到指定位置: 对齐后行首与词间隙可能有空白
     else {
-        unit_t offthis = pos.x;
         uint32_t char_offset_in_line = line0.char_len_before;
         const auto cfor = impl::cfor_cells(line0.first, last);
         auto target = last;
         for (auto& cell : cfor) {
-            if (offthis < cell.metrics.width
+            if (pos.x < cell.metrics.pos + cell.metrics.width
 #ifndef RED_NO_RUBY
                 && cell.metrics.width) {
                 // 注音的特殊处理  开始
                 if (cell.RefMetaInfo().metatype == Type_UnderRuby) {
                     // 在后面一半
-                    if (offthis >= half(cell.metrics.width)) {
+                    if (pos.x >= cell.metrics.pos + half(cell.metrics.width)) {
                         char_offset_in_line += cell.RefString().length;
-                        offthis -= cell.metrics.width;
                         continue;
                     }
                 }
@@ -3166,8 +4759,8 @@ bool RichED::CEDTextDocument::Private::HitTest(
                 target = &cell; break;
             }
             char_offset_in_line += cell.RefString().length;
-            offthis -= cell.metrics.width;
         }
+        const auto offthis = std::max(pos.x - target->metrics.pos, unit_t(0));
         const auto ht = doc.platform.HitTest(*target, offthis);
         ctx.text_cell = target;
         ctx.len_before_cell = char_offset_in_line;
@@ -3187,13 +4780,18 @@ void RichED::CEDTextDocument::Private::HitTest(
     CEDTextDocument& doc, DocPoint dp, HitTestCtx& ctx) noexcept {
     const auto dp_bk = dp;
     ctx.text_cell = nullptr;
-    // 扩展到指定行
+    // 扩展到指定行, 之前的行可以只估计
+    Private::SkipVL(doc, dp.line, max_unit());
     Private::ExpandVL(doc, dp.line, max_unit());
     // 二分查找到指定行
     auto& vlv = doc.m_vVisual;
-    const auto size = vlv.GetSize();
-    const auto bad_end = vlv.end() - 1;
     auto itr = RichED::LowerVL(vlv.begin(), vlv.end(), dp.line);
+    // 估计行需要先布局
+    if (itr < vlv.end() - 1 && itr->estimated) {
+        if (!Private::FillVL(doc, dp.line, dp.line + 1)) return;
+        itr = RichED::LowerVL(vlv.begin(), vlv.end(), dp.line);
+    }
+    const auto bad_end = vlv.end() - 1;
     // 最后一个
     //if (itr == bad_end && dp.pos == 0) {
     //    ctx.text_cell = static_cast<CEDTextCell*>(bad_end->first->prev);
@@ -3219,6 +4817,7 @@ void RichED::CEDTextDocument::Private::HitTest(
         auto cell = itr->first;
         auto pos = dp.pos;
         impl::find_cell1_txtoff_ex(cell, pos);
+        Private::AlignVL(doc, *itr);
         ctx.visual_line = itr;
         ctx.len_before_cell += dp.pos - pos;
         ctx.pos_in_cell = pos;
@@ -3266,13 +4865,9 @@ void RichED::CEDTextDocument::Private::RefreshCaret(
         auto& cell = *ctx.text_cell;
         const auto pos = ctx.pos_in_cell;
         const auto cm = doc.platform.GetCharMetrics(cell, pos);
-        // TODO: 固定行高
         doc.m_rcCaret.x = cell.metrics.pos + cm.offset;
-        doc.m_rcCaret.y = ctx.visual_line->offset;
-        doc.m_rcCaret.height
-            = ctx.visual_line->ar_height_max
-            + ctx.visual_line->dr_height_max
-            ;
+        doc.m_rcCaret.y = Private::OffsetVL(doc, *ctx.visual_line);
+        doc.m_rcCaret.height = Private::HeightVL(doc, *ctx.visual_line);
         Private::ValueChanged(doc, Changed_Caret);
     }
     // TODO: 部分情况视口跟随插入符
@@ -3317,7 +4912,10 @@ void RichED::CEDTextDocument::Private::RefreshSelection(
     if (Cmp(begin) >= Cmp(end)) return;
     HitTestCtx bctx, ectx;
     Private::HitTest(doc, begin, bctx);
+    const auto data = doc.m_vVisual.GetData();
     Private::HitTest(doc, end, ectx);
+    // 后者可能扩展了视觉行缓存
+    if (data != doc.m_vVisual.GetData()) Private::HitTest(doc, begin, bctx);
     // TODO: 错误处理
     assert(bctx.text_cell && ectx.text_cell);
     if (!(bctx.text_cell && ectx.text_cell)) return;
@@ -3335,12 +4933,15 @@ void RichED::CEDTextDocument::Private::RefreshSelection(
     const auto cm1 = doc.platform.GetCharMetrics(*cell1, pos1);
     auto& first = vec[0];
     auto& last = vec[count - 1];
-    const auto set_height = [](Box& box, const VisualLine& vl) noexcept {
-        box.top = vl.offset;
-        box.bottom = box.top + vl.ar_height_max + vl.dr_height_max;
+    auto top = Private::OffsetVL(doc, *line0);
+    const auto set_height = [&doc](Box& box, const VisualLine& vl, unit_t top) noexcept {
+        box.top = top;
+        box.bottom = box.top + Private::HeightVL(doc, vl);
     };
     const auto set_end = [&doc](Box& box, const VisualLine& vl) noexcept {
         assert(vl.first != &doc.m_tail);
+        // 估计行还没有布局, 显示时会刷新
+        if (vl.estimated) { box.right = 0; return; }
         const auto last_cell = static_cast<CEDTextCell*>(1[&vl].first->prev);
         const auto right = last_cell->metrics.pos + last_cell->metrics.width;
         box.right = right;
@@ -3348,8 +4949,8 @@ void RichED::CEDTextDocument::Private::RefreshSelection(
         if (last_cell->RefMetaInfo().eol)
             box.right += half(last_cell->RefRichED().size);
     };
-    const auto set_start = [&doc](Box& box, const VisualLine& vl) noexcept {
-        box.left = 0;
+    const auto set_start = [](Box& box, const VisualLine& vl) noexcept {
+        box.left = vl.estimated ? unit_t(0) : vl.first->metrics.pos;
     };
      // 1. 设置第一行末尾位置, 最后一行行首位置
     set_end(first, *line0);
@@ -3357,15 +4958,59 @@ void RichED::CEDTextDocument::Private::RefreshSelection(
      // 2. 设置第一行行首位置, 最后一行末尾位置
     first.left = cell0->metrics.pos + cm0.offset;
     last.right = cell1->metrics.pos + cm1.offset;
-    set_height(last, *line1);
      // 3. 中间行设置上一行末尾(需确认EOL), 这一行行首位置
     auto box_itr = &first;
-    std::for_each(line0, line1, [=](const VisualLine& vl) mutable noexcept {
+    std::for_each(line0, line1, [=, &doc, &top](VisualLine& vl) mutable noexcept {
         set_end(*box_itr, vl);
-        set_height(*box_itr, vl);
+        set_height(*box_itr, vl, top);
+        top += Private::HeightVL(doc, vl);
         ++box_itr;
-        set_start(*box_itr, vl);
+        Private::AlignVL(doc, 1[&vl]);
+        set_start(*box_itr, 1[&vl]);
     });
+    set_height(last, *line1, top);
+}
+
+
+/// <summary>
+/// Grapheme clusters of cell, computed on demand.
+/// </summary>
+/// <param name="first">The first cell of logic line.</param>
+/// <param name="cell">The cell.</param>
+/// <returns>bits of cluster boundaries</returns>
+auto RichED::CEDTextDocument::Private::Clusters(
+    CEDTextCell& first, CEDTextCell& cell) noexcept -> const uint32_t* {
+    static_assert(TEXT_CELL_STR_MAXLEN <= sizeof(cell.clusters.bits) * 8, "bits of cell");
+    // 向前找到离开状态可信的CELL: 内联对象, 或者已计算且状态不依赖之前的
+    auto head = &cell;
+    while (head != &first) {
+        const auto prev = impl::prev_cell(head);
+        const auto& meta = prev->RefMetaInfo();
+        if (meta.metatype != Type_Normal) break;
+        if (meta.segmented && !prev->clusters.transparent) break;
+        head = prev;
+    }
+    uint8_t state = head == &first
+        ? uint8_t(CEDGraphemeBreaker::STATE_SOT)
+        : impl::cell_leave(*impl::prev_cell(head));
+    // 依次计算, 进入状态未变的无需重算
+    for (auto node = head; ; node = impl::next_cell(node)) {
+        auto& info = node->clusters;
+        if (node->RefMetaInfo().metatype != Type_Normal)
+            state = CEDGraphemeBreaker::STATE_SOT;
+        if (!node->RefMetaInfo().segmented || info.enter != state) {
+            const auto& str = node->RefString();
+            CEDGraphemeBreaker breaker{ state };
+            info.bits[0] = info.bits[1] = 0;
+            info.transparent = breaker.Feed(str.data, str.length, info.bits, 0);
+            info.enter = state;
+            info.leave = breaker.GetState();
+            node->AsSegmented();
+        }
+        state = impl::cell_leave(*node);
+        if (node == &cell) break;
+    }
+    return cell.clusters.bits;
 }
 
 
@@ -3380,7 +5025,7 @@ auto RichED::CEDTextDocument::Private::LogicLeft(
     CEDTextDocument& doc, DocPoint dp) noexcept -> DocPoint {
     const auto& llv = doc.m_vLogic;
     const auto s = llv.GetSize();
-    DocPoint rv = { 0 };
+    DocPoint rv = { 0, 0 };
     if (dp.line < s) {
         const auto& line = llv[dp.line];
         // 向前搜索
@@ -3404,16 +5049,23 @@ auto RichED::CEDTextDocument::Private::LogicLeft(
                     rv.pos -= cell->RefString().length;
                 }
             }
-            // 否则检查UTF16规则, 避免移动到错误地点
+            // 否则按字素簇移动, 簇可能跨越多个CELL
             else {
-                --rv.pos;
-                if (impl::is_2nd_surrogate(cell->RefString().data[pos - 1])) --rv.pos;
+                while (true) {
+                    const auto bits = Private::Clusters(*first_cell, *cell);
+                    const auto found = FindBitBackward(bits, 0, pos);
+                    if (found != pos) { rv.pos -= pos - found; break; }
+                    rv.pos -= pos;
+                    if (cell == first_cell) break;
+                    cell = impl::prev_cell(cell);
+                    pos = cell->RefString().length;
+                }
             }
         }
         // 处于行首
         else {
             // 换到上一行末尾
-            if (dp.line)  rv = { dp.line - 1 , (&line)[-1].length };
+            if (dp.line)  rv = { dp.line - 1 , llv[dp.line - 1].length };
         }
     }
     return rv;
@@ -3430,7 +5082,7 @@ auto RichED::CEDTextDocument::Private::LogicRight(
     CEDTextDocument & doc, DocPoint dp) noexcept -> DocPoint {
     const auto& llv = doc.m_vLogic;
     const auto s = llv.GetSize();
-    DocPoint rv = { 0 };
+    DocPoint rv = { 0, 0 };
     if (dp.line < s) {
         const auto line = llv[dp.line];
         // 处于行末
@@ -3454,11 +5106,19 @@ auto RichED::CEDTextDocument::Private::LogicRight(
                     rv.pos += cell->RefString().length;
                 }
             }
-            // 否则检查UTF16规则, 避免移动到错误地点
+            // 否则按字素簇移动, 簇可能跨越多个CELL
             else {
                 assert(pos < cell->RefString().length && "BAD ACTION");
-                ++rv.pos;
-                if (impl::is_1st_surrogate(cell->RefString().data[pos])) ++rv.pos;
+                auto from = pos + 1;
+                while (true) {
+                    const uint32_t len = cell->RefString().length;
+                    const auto bits = Private::Clusters(*line.first, *cell);
+                    const auto found = FindBitForward(bits, from, len);
+                    rv.pos += found - pos;
+                    if (found != len || cell->RefMetaInfo().eol) break;
+                    cell = impl::next_cell(cell);
+                    pos = from = 0;
+                }
             }
         }
     }
@@ -3473,8 +5133,27 @@ auto RichED::CEDTextDocument::Private::LogicRight(
 /// <returns></returns>
 auto RichED::CEDTextDocument::Private::WordLeft(
     CEDTextDocument& doc, DocPoint dp) noexcept -> DocPoint{
-    // TODO: 具体实现
-    return Private::LogicLeft(doc, dp);
+    const auto& llv = doc.m_vLogic;
+    // 处于行首则换到上一行末尾
+    if (dp.line >= llv.GetSize() || !dp.pos) return Private::LogicLeft(doc, dp);
+    const auto& line = llv[dp.line];
+    dp.pos = std::min(dp.pos, line.length);
+    // 密码模式下整行视为一个词
+    if (doc.m_info.flags & Flag_UsePassword) return { dp.line, 0 };
+    const CEDWordBreaker breaker{ doc.m_pWordDict };
+    WordCursor cursor{ line.first, line.first, dp.pos, dp.pos };
+    impl::find_cell1_txtoff_ex(cursor.cell, cursor.off);
+    // 跳过之前的空白
+    while (true) {
+        auto itr = cursor;
+        const auto ch = itr.Prev();
+        if (ch == CEDWordBreaker::WORD_END || !CEDWordBreaker::IsSpace(ch)) break;
+        breaker.Prev(cursor);
+    }
+    // 移动到词首, 内联对象以及注音按字符移动
+    if (!breaker.Prev(cursor) && cursor.pos)
+        return Private::LogicLeft(doc, { dp.line, cursor.pos });
+    return { dp.line, cursor.pos };
 }
 
 /// <summary>
@@ -3485,8 +5164,30 @@ auto RichED::CEDTextDocument::Private::WordLeft(
 /// <returns></returns>
 auto RichED::CEDTextDocument::Private::WordRight(
     CEDTextDocument & doc, DocPoint dp) noexcept -> DocPoint {
-    // TODO: 具体实现
-    return Private::LogicRight(doc, dp);
+    const auto& llv = doc.m_vLogic;
+    if (dp.line >= llv.GetSize()) return Private::LogicRight(doc, dp);
+    const auto& line = llv[dp.line];
+    // 处于行末则换到下一行行首
+    if (dp.pos >= line.length) return Private::LogicRight(doc, dp);
+    // 密码模式下整行视为一个词
+    if (doc.m_info.flags & Flag_UsePassword) return { dp.line, line.length };
+    const CEDWordBreaker breaker{ doc.m_pWordDict };
+    WordCursor cursor{ line.first, line.first, dp.pos, dp.pos };
+    impl::find_cell2_txtoff_ex(cursor.cell, cursor.off);
+    // 移动到词尾, 内联对象以及注音按字符移动
+    if (!breaker.Next(cursor)) {
+        cursor = { line.first, line.first, 0, Private::LogicRight(doc, dp).pos };
+        cursor.off = cursor.pos;
+        impl::find_cell2_txtoff_ex(cursor.cell, cursor.off);
+    }
+    // 跳过之后的空白, 停在下一个词首
+    while (true) {
+        auto itr = cursor;
+        const auto ch = itr.Next();
+        if (ch == CEDWordBreaker::WORD_END || !CEDWordBreaker::IsSpace(ch)) break;
+        breaker.Next(cursor);
+    }
+    return { dp.line, cursor.pos };
 }
 
 
@@ -28,12 +28,18 @@
 #include "ed_common.h"
 #include "ed_txtbuf.h"
 #include "ed_undoredo.h"
+#include "ed_txtpool.h"
+#include "ed_txtstyle.h"
+#include "ed_txtindex.h"
+#include "ed_txtworker.h"
 #include <cstddef>
 
 // riched namespace
 namespace RichED {
     // text platform
     struct IEDTextPlatform;
+    // word dictionary
+    struct IEDWordDictionary;
     // text cell
     class CEDTextCell;
     // logic line(LL) data
@@ -42,6 +48,8 @@ namespace RichED {
         CEDTextCell*    first;
         // text length, LF not included
         uint32_t        length;
+        // wrap cache record in m_vWrap, 0 if none
+        uint32_t        wrap;
     };
     // visual line(VL) data
     struct VisualLine {
@@ -53,12 +61,54 @@ namespace RichED {
         uint32_t        char_len_before;
         // char length for this visual-line
         uint32_t        char_len_this;
-        // offset for this visual-line
-        unit_t          offset;
         // max ascender-height in this visual-line
         unit_t          ar_height_max;
         // max deascender-height in this visual-line
         unit_t          dr_height_max;
+        // estimated[not laid out yet], whole logic line in this visual-line
+        uint32_t        estimated : 1;
+        // text-align generation of cell pos, 0 for leading pos from layout
+        uint32_t        aligned : 31;
+    };
+    // result of compacting cells
+    struct CompactInfo {
+        // next logic line to compact, == line count if finished
+        uint32_t        next_line;
+        // cell count of compacted lines before compacting
+        uint32_t        cell_before;
+        // cell count of compacted lines after compacting
+        uint32_t        cell_after;
+    };
+    // memory statistics of document
+    struct DocMemoryStats {
+        // cell count
+        uint32_t        cell_count;
+        // cell count allocated from pool
+        uint32_t        cell_pooled;
+        // live platform context count
+        uint32_t        context_count;
+        // undo-op count
+        uint32_t        undo_count;
+        // logic line: size and capacity
+        uint32_t        logic_size, logic_capacity;
+        // visual line: size and capacity
+        uint32_t        visual_size, visual_capacity;
+        // selection: size and capacity
+        uint32_t        selection_size, selection_capacity;
+        // bytes of cells
+        size_t          cell_bytes;
+        // bytes of string capacity in cells
+        size_t          string_bytes;
+        // bytes of live text in cells
+        size_t          text_bytes;
+        // bytes of cell pool chunks, free objects included
+        size_t          pool_bytes;
+        // bytes of line buffers: logic + visual[height index included] + wrap cache + selection
+        size_t          buffer_bytes;
+        // bytes of undo stack
+        size_t          undo_bytes;
+        // bytes of style table
+        size_t          style_bytes;
     };
     // value changed flag
     enum ValuedChanged : uint32_t;
@@ -103,8 +153,20 @@ namespace RichED {
         CEDTextDocument(const CEDTextDocument&) noexcept = delete;
         // alloc mem
         void*Alloc(size_t) noexcept;
-        // update
-        auto Update() noexcept->ValuedChanged;
+        // alloc normal cell mem from pool of cell class
+        void*AllocCell(uint32_t index) noexcept { return m_pools[index].Alloc(*this); }
+        // free normal cell mem to pool of cell class
+        void FreeCell(void* ptr, uint32_t index) noexcept { m_pools[index].Free(ptr); }
+        // get riched-data of style id
+        auto&RefStyle(uint16_t id) const noexcept { return m_styles.Get(id); }
+        // find or add style, return TEXT_STYLE_INVALID if failed
+        auto InternStyle(const RichData& rd) noexcept { return m_styles.Intern(rd, *this); }
+        // get cell index
+        auto&RefCellIndex() noexcept { return m_index; }
+        // is list head node
+        bool IsHead(const Node& node) const noexcept { return &node == &m_head; }
+        // update, then lay out rest lines until budget[us] used up, Changed_LayoutPending set if unfinished
+        auto Update(uint32_t budget_us = 0) noexcept->ValuedChanged;
         // render
         void Render(CtxPtr) noexcept;
         // move current doc view-point pos[relatively]
@@ -120,7 +182,7 @@ namespace RichED {
         // gen text
         void GenText(CtxPtr ctx, DocPoint begin, DocPoint end)noexcept;
         // get estimated size in view space
-        auto GetEstimatedSize() const noexcept -> Size;
+        auto GetEstimatedSize() noexcept -> Size;
         // get logic line count 
         auto GetLogicLineCount() const noexcept { return m_vLogic.GetSize(); }
         // get selection
@@ -131,14 +193,30 @@ namespace RichED {
         auto&RefLineFeed() const noexcept { return m_linefeed; }
         // get info
         auto&RefInfo() const noexcept { return m_info; }
+        // get memory statistics, walk all cells
+        auto GetMemoryStats() noexcept->DocMemoryStats;
         // get matrix
         auto&RefMatrix() const noexcept { return m_matrix; }
         // set new line feed
         void SetLineFeed(LineFeed) noexcept;
+        // set text align, cells not reshaped
+        void SetTextAlign(TextAlign) noexcept;
+        // set word dictionary for moving by word in CJK/Thai text, null for none, not owned
+        void SetWordDictionary(IEDWordDictionary* dict) noexcept { m_pWordDict = dict; }
         // get selection
         auto GetSelectionRange() const noexcept { return DocRange{ m_dpSelBegin, m_dpSelEnd }; }
         // force change all riched
         void ForceResetAllRiched() noexcept;
+        // merge adjacent same-style cells from logic line, stop at line end once budget(cell count) used up
+        auto Compact(uint32_t line, uint32_t budget) noexcept->CompactInfo;
+        // begin laying out rest lines on background thread, false if nothing to do or thread not created.
+        // idle-time task, NOT a snapshot: worker lays out the document in place and owns it until
+        // EndLayoutAsync, every public call (except VAlignHelperH and inline getters) ends it first
+        bool BeginLayoutAsync() noexcept;
+        // end background layout and publish laid-out lines, Changed_LayoutAsync set if progressed
+        void EndLayoutAsync() noexcept;
+        // lay out all lines, logic lines partitioned into chunks laid out on threads, serial without Flag_ThreadSafePlatform
+        void LayoutAll(uint32_t thread_count) noexcept;
     public: // Low level 
         // begin an operation for undo-stack
         void BeginOp() noexcept;
@@ -152,6 +230,8 @@ namespace RichED {
         auto InsertText(DocPoint, U16View, bool behind =true) noexcept ->DocPoint;
         // remove text, pos = min(DocPoint::pos, line-length)
         bool RemoveText(DocPoint begin, DocPoint end) noexcept;
+        // replace whole text in one pass, undo-stack cleared, not recorded, unchanged if oom
+        bool Assign(U16View) noexcept;
     public: // Rich Text Format
         // type ref
         using color_t = decltype(RichData::color);
@@ -259,6 +339,18 @@ namespace RichED {
     private:
         // undo stack
         CEDUndoRedo             m_undo;
+        // normal cell pools, one for each cell class
+        CEDCellPool             m_pools[TEXT_CELL_CLASS_COUNT];
+        // interned style table
+        CEDStyleTable           m_styles;
+        // cell index for position lookup
+        CEDCellIndex            m_index;
+        // height index of visual lines, offset lookup
+        CEDHeightIndex          m_height;
+        // background layout worker
+        CEDLayoutWorker         m_worker;
+        // parallel layout threads
+        CEDLayoutPool           m_pool;
         // matrix
         DocMatrix               m_matrix;
         // normal info
@@ -273,6 +365,16 @@ namespace RichED {
         Size                    m_szEstimated;
         // document estimate size - compare ver
         Size                    m_szEstimatedCmp;
+        // word dictionary, null for none
+        IEDWordDictionary*      m_pWordDict = nullptr;
+        // viewport width of current layout
+        unit_t                  m_fLayoutWidth = 0;
+        // logic line count per budgeted layout step, adapted to budget
+        uint32_t                m_uLayoutStep = LAYOUT_ASYNC_LINE;
+        // logic line count per background layout step, adapted to LAYOUT_ASYNC_US
+        uint32_t                m_uAsyncStep = LAYOUT_ASYNC_LINE;
+        // text-align generation, changed with text align or viewport width
+        uint32_t                m_uAlignGen = 1;
         // anchor pos
         DocPoint                m_dpAnchor;
         // caret pos
@@ -281,6 +383,15 @@ namespace RichED {
         DocPoint                m_dpSelBegin;
         // selection end
         DocPoint                m_dpSelEnd;
+        // clean visual lines after the dirty logic line, [begin, end) beyond size of m_vVisual
+        uint32_t                m_uTailBegin = 0;
+        // end of clean visual lines, == begin if none
+        uint32_t                m_uTailEnd = 0;
+        // logic line delta of clean visual lines, ShiftVL is O(log n), applied in O(tail) when moved or spliced
+        int32_t                 m_iTailDelta = 0;
+        // gap made when laid-out lines reach clean visual lines, doubled each time,
+        // each gap made moves the clean visual lines in O(tail)
+        uint32_t                m_uTailGrow = 0;
         // undo op
         uint16_t                m_uUndoOp = 0;
         // undo ok
@@ -301,8 +412,10 @@ namespace RichED {
 #endif
         // visual lines cache
         CEDBuffer<VisualLine>   m_vVisual;
-        // logic line data
-        CEDBuffer<LogicLine>    m_vLogic;
+        // logic line data, gap at the last edited line
+        CEDGapBuffer<LogicLine> m_vLogic;
+        // wrap cache: break opportunities of logic lines, break positions keyed by viewport width
+        CEDBuffer<uint32_t>     m_vWrap;
         // selection data
         CEDBuffer<Box>          m_vSelection;
     public:
@@ -338,5 +451,11 @@ namespace RichED {
         Changed_ViewportWidth   = 1 << 6,
         // viewport height changed
         Changed_ViewportHeight  = 1 << 7,
+        // background or budgeted layout progressed
+        Changed_LayoutAsync     = 1 << 8,
+        // budgeted layout unfinished, call Update with budget again
+        Changed_LayoutPending   = 1 << 9,
+        // older undo history dropped to free style ids held only by it
+        Changed_UndoDropped     = 1 << 10,
     };
 }
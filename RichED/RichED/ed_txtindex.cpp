@@ -0,0 +1,359 @@
+﻿#include "ed_txtcell.h"
+#include "ed_txtdoc.h"
+#include "ed_txtindex.h"
+#include <cassert>
+
+// RichED::impl
+namespace RichED { namespace impl {
+    // string length of cell
+    inline uint32_t idx_len(const CEDTextCell* cell) noexcept {
+        return cell->RefString().length;
+    }
+    // string length of subtree
+    inline uint32_t idx_sum(const CEDTextCell* cell) noexcept {
+        return cell ? cell->index.sum : 0;
+    }
+    // recalculate sum
+    inline void idx_recalc(CEDTextCell& cell) noexcept {
+        cell.index.sum = idx_sum(cell.index.left) + idx_len(&cell) + idx_sum(cell.index.right);
+    }
+    // lowest bit
+    inline uint32_t idx_lowbit(uint32_t i) noexcept { return i & (0 - i); }
+    // height of visual line
+    inline unit_t idx_height(const VisualLine& vl) noexcept {
+        return vl.ar_height_max + vl.dr_height_max;
+    }
+}}
+
+/// <summary>
+/// Nexts the priority.
+/// </summary>
+/// <returns></returns>
+auto RichED::CEDCellIndex::next_priority() noexcept -> uint32_t {
+    // xorshift32, 0表示不在索引中
+    auto x = m_uSeed;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    m_uSeed = x;
+    return x | 1;
+}
+
+/// <summary>
+/// Replaces the child.
+/// </summary>
+/// <param name="parent">The parent.</param>
+/// <param name="old">The old.</param>
+/// <param name="now">The now.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::replace_child(
+    CEDTextCell* parent, const CEDTextCell* old, CEDTextCell* now) noexcept {
+    if (!parent) m_pRoot = now;
+    else if (parent->index.left == old) parent->index.left = now;
+    else { assert(parent->index.right == old); parent->index.right = now; }
+}
+
+/// <summary>
+/// Rotates node up over its parent.
+/// </summary>
+/// <param name="node">The node.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::rotate_up(CEDTextCell& node) noexcept {
+    const auto parent = node.index.parent;
+    assert(parent);
+    const auto grand = parent->index.parent;
+    // 左子节点: 右旋
+    if (parent->index.left == &node) {
+        const auto mid = node.index.right;
+        parent->index.left = mid;
+        if (mid) mid->index.parent = parent;
+        node.index.right = parent;
+    }
+    // 右子节点: 左旋
+    else {
+        const auto mid = node.index.left;
+        parent->index.right = mid;
+        if (mid) mid->index.parent = parent;
+        node.index.left = parent;
+    }
+    parent->index.parent = &node;
+    node.index.parent = grand;
+    this->replace_child(grand, parent, &node);
+    // 子树总长: 新根继承原根
+    node.index.sum = parent->index.sum;
+    impl::idx_recalc(*parent);
+}
+
+/// <summary>
+/// Inserts cell after the prev cell.
+/// </summary>
+/// <param name="prev">The previous cell, null for list head.</param>
+/// <param name="cell">The cell.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::Insert(CEDTextCell* prev, CEDTextCell& cell) noexcept {
+    assert(cell.index.priority == 0 && "indexed");
+    const auto len = impl::idx_len(&cell);
+    cell.index.left = nullptr;
+    cell.index.right = nullptr;
+    cell.index.parent = nullptr;
+    cell.index.sum = len;
+    cell.index.priority = this->next_priority();
+    if (!m_pRoot) { m_pRoot = &cell; return; }
+    // 链表头之后: 作为最左节点
+    CEDTextCell* parent;
+    if (!prev) {
+        parent = m_pRoot;
+        while (parent->index.left) parent = parent->index.left;
+        parent->index.left = &cell;
+    }
+    else {
+        assert(prev->index.priority && "prev not indexed");
+        // 中序后继: 前驱无右子树则作为右子节点, 否则作为右子树最左节点
+        if (!prev->index.right) {
+            parent = prev;
+            parent->index.right = &cell;
+        }
+        else {
+            parent = prev->index.right;
+            while (parent->index.left) parent = parent->index.left;
+            parent->index.left = &cell;
+        }
+    }
+    cell.index.parent = parent;
+    for (auto p = parent; p; p = p->index.parent) p->index.sum += len;
+    // 按优先级上浮
+    while (cell.index.parent && cell.index.parent->index.priority < cell.index.priority)
+        this->rotate_up(cell);
+}
+
+/// <summary>
+/// Removes the cell.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::Remove(CEDTextCell& cell) noexcept {
+    assert(cell.index.priority && "not indexed");
+    // 下沉至最多一个子节点
+    while (cell.index.left && cell.index.right) {
+        const auto l = cell.index.left, r = cell.index.right;
+        this->rotate_up(l->index.priority > r->index.priority ? *l : *r);
+    }
+    const auto child = cell.index.left ? cell.index.left : cell.index.right;
+    const auto parent = cell.index.parent;
+    if (child) child->index.parent = parent;
+    this->replace_child(parent, &cell, child);
+    const auto len = impl::idx_len(&cell);
+    for (auto p = parent; p; p = p->index.parent) p->index.sum -= len;
+    cell.index.priority = 0;
+}
+
+/// <summary>
+/// Rebuilds the index from cells between head and tail.
+/// </summary>
+/// <param name="head">The head node.</param>
+/// <param name="tail">The tail node.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::Build(const Node& head, const Node& tail) noexcept {
+    // 笛卡尔树线性构建: 沿右链上爬, 离开右链的子树已经完整
+    CEDTextCell* last = nullptr;
+    m_pRoot = nullptr;
+    for (auto node = head.next; node != &tail; node = node->next) {
+        const auto cell = static_cast<CEDTextCell*>(node);
+        cell->index.right = nullptr;
+        cell->index.sum = impl::idx_len(cell);
+        cell->index.priority = this->next_priority();
+        CEDTextCell* child = nullptr;
+        auto parent = last;
+        while (parent && parent->index.priority < cell->index.priority) {
+            impl::idx_recalc(*parent);
+            child = parent;
+            parent = parent->index.parent;
+        }
+        cell->index.left = child;
+        if (child) child->index.parent = cell;
+        cell->index.parent = parent;
+        if (parent) parent->index.right = cell;
+        else m_pRoot = cell;
+        last = cell;
+    }
+    // 剩余右链
+    for (auto p = last; p; p = p->index.parent) impl::idx_recalc(*p);
+}
+
+/// <summary>
+/// Updates the specified cell.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <param name="delta">The delta.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::Update(CEDTextCell& cell, int32_t delta) noexcept {
+    assert(cell.index.priority && "not indexed");
+    const auto u32 = static_cast<uint32_t>(delta);
+    for (auto p = &cell; p; p = p->index.parent) p->index.sum += u32;
+}
+
+/// <summary>
+/// Relocates the specified cell.
+/// </summary>
+/// <param name="from">From.</param>
+/// <param name="to">To, copied from 'from'.</param>
+/// <returns></returns>
+void RichED::CEDCellIndex::Relocate(const CEDTextCell& from, CEDTextCell& to) noexcept {
+    assert(from.index.priority && "not indexed");
+    if (const auto l = to.index.left) l->index.parent = &to;
+    if (const auto r = to.index.right) r->index.parent = &to;
+    this->replace_child(to.index.parent, &from, &to);
+}
+
+/// <summary>
+/// Get string length before the cell.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <returns></returns>
+auto RichED::CEDCellIndex::Prefix(const CEDTextCell& cell) const noexcept -> uint32_t {
+    assert(cell.index.priority && "not indexed");
+    uint32_t len = impl::idx_sum(cell.index.left);
+    auto node = &cell;
+    while (const auto parent = node->index.parent) {
+        if (parent->index.right == node)
+            len += impl::idx_sum(parent->index.left) + impl::idx_len(parent);
+        node = parent;
+    }
+    return len;
+}
+
+/// <summary>
+/// Finds the first cell ends at or after pos.
+/// </summary>
+/// <param name="pos">The position, should not be 0.</param>
+/// <param name="offset">The offset in cell.</param>
+/// <returns>null if out of range</returns>
+auto RichED::CEDCellIndex::Find(uint32_t pos, uint32_t& offset) const noexcept -> CEDTextCell* {
+    assert(pos && "pos cannot be 0");
+    auto node = m_pRoot;
+    while (node) {
+        const auto left = impl::idx_sum(node->index.left);
+        const auto len = impl::idx_len(node);
+        if (pos <= left) node = node->index.left;
+        else if (pos <= left + len) { offset = pos - left; return node; }
+        else { pos -= left + len; node = node->index.right; }
+    }
+    return nullptr;
+}
+
+/// <summary>
+/// Gets the total string length.
+/// </summary>
+/// <returns></returns>
+auto RichED::CEDCellIndex::GetTotal() const noexcept -> uint32_t {
+    return impl::idx_sum(m_pRoot);
+}
+
+
+// ----------------------------------------------------------------------------
+//                          RichED::CEDHeightIndex
+// ----------------------------------------------------------------------------
+
+/// <summary>
+/// Resizes the tree.
+/// </summary>
+/// <param name="count">The count.</param>
+/// <param name="plat">The plat.</param>
+/// <returns></returns>
+bool RichED::CEDHeightIndex::resize(uint32_t count, IEDTextPlatform& plat) noexcept {
+    // 成倍扩容
+    if (count > m_vTree.GetCapacity()) {
+        const auto size = m_vTree.GetSize();
+        const auto cap = count > size + (size >> 1) ? count : size + (size >> 1);
+        if (!m_vTree.Resize(cap, plat)) return false;
+    }
+    return m_vTree.Resize(count, plat);
+}
+
+/// <summary>
+/// Sets the height of line.
+/// </summary>
+/// <param name="index">The index.</param>
+/// <param name="height">The height.</param>
+/// <param name="plat">The plat.</param>
+/// <returns></returns>
+bool RichED::CEDHeightIndex::Set(uint32_t index, unit_t height, IEDTextPlatform& plat) noexcept {
+    const auto count = m_vTree.GetSize();
+    assert(index <= count && "out of range");
+    const auto i = index + 1;
+    const auto low = i - impl::idx_lowbit(i);
+    // 末尾添加: 节点覆盖(low, i]
+    if (index == count) {
+        if (!this->resize(count + 1, plat)) return false;
+        for (auto j = index; j > low; j -= impl::idx_lowbit(j)) height += this->node(j);
+        this->node(i) = height;
+        return true;
+    }
+    // 修改: 计算原高度后向上更新
+    auto old = this->node(i);
+    for (auto j = index; j > low; j -= impl::idx_lowbit(j)) old -= this->node(j);
+    const auto delta = height - old;
+    if (delta != 0) {
+        for (auto j = i; j <= count; j += impl::idx_lowbit(j)) this->node(j) += delta;
+    }
+    return true;
+}
+
+/// <summary>
+/// Rebuilds lines in [begin, end).
+/// </summary>
+/// <param name="begin">The begin.</param>
+/// <param name="gap">The gap end, [begin, gap) as zero height.</param>
+/// <param name="end">The end.</param>
+/// <param name="lines">The lines.</param>
+/// <param name="plat">The plat.</param>
+/// <returns></returns>
+bool RichED::CEDHeightIndex::Rebuild(uint32_t begin, uint32_t gap, uint32_t end,
+    const VisualLine* lines, IEDTextPlatform& plat) noexcept {
+    assert(begin <= gap && gap <= end && begin <= m_vTree.GetSize());
+    if (!this->resize(end, plat)) return false;
+    for (auto i = begin; i != gap; ++i) this->node(i + 1) = 0;
+    for (auto i = gap; i != end; ++i) this->node(i + 1) = impl::idx_height(lines[i]);
+    // 前面的节点中, 父节点在范围内的只有begin的前缀分解
+    for (auto j = begin; j; j -= impl::idx_lowbit(j)) {
+        const auto parent = j + impl::idx_lowbit(j);
+        if (parent <= end) this->node(parent) += this->node(j);
+    }
+    // 线性构建
+    for (auto i = begin + 1; i <= end; ++i) {
+        const auto parent = i + impl::idx_lowbit(i);
+        if (parent <= end) this->node(parent) += this->node(i);
+    }
+    return true;
+}
+
+/// <summary>
+/// Sum of heights in [0, count).
+/// </summary>
+/// <param name="count">The count.</param>
+/// <returns></returns>
+auto RichED::CEDHeightIndex::Prefix(uint32_t count) const noexcept -> unit_t {
+    assert(count <= m_vTree.GetSize() && "out of range");
+    unit_t sum = 0;
+    for (auto j = count; j; j -= impl::idx_lowbit(j)) sum += this->node(j);
+    return sum;
+}
+
+/// <summary>
+/// Finds max count that prefix sum of heights &lt;= offset.
+/// </summary>
+/// <param name="offset">The offset.</param>
+/// <returns></returns>
+auto RichED::CEDHeightIndex::Find(unit_t offset) const noexcept -> uint32_t {
+    const auto count = m_vTree.GetSize();
+    uint32_t step = 1;
+    while ((step << 1) <= count && (step << 1)) step <<= 1;
+    uint32_t pos = 0;
+    // 二进制下降
+    for (; step; step >>= 1) {
+        const auto next = pos + step;
+        if (next <= count && this->node(next) <= offset) {
+            pos = next;
+            offset -= this->node(next);
+        }
+    }
+    return pos;
+}
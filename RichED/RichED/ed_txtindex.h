@@ -0,0 +1,123 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ed_config.h"
+#include "ed_txtbuf.h"
+#include <cstdint>
+
+// RichED namespace
+namespace RichED {
+    // node
+    struct Node;
+    // text cell
+    class CEDTextCell;
+    // visual line
+    struct VisualLine;
+    // index node of cell, managed by CEDCellIndex
+    struct CellIndexNode {
+        // left child
+        CEDTextCell*        left;
+        // right child
+        CEDTextCell*        right;
+        // parent
+        CEDTextCell*        parent;
+        // string length of subtree
+        uint32_t            sum;
+        // heap priority, 0 if not indexed
+        uint32_t            priority;
+    };
+    // cell index: treap over linked cells, in-order = list order,
+    // augmented with string length so cell of a position found in O(log n)
+    class CEDCellIndex {
+    public:
+        // ctor
+        CEDCellIndex() noexcept {}
+        // no copy ctor
+        CEDCellIndex(const CEDCellIndex&) noexcept = delete;
+        // insert cell after prev[null for list head], cell should be linked
+        void Insert(CEDTextCell* prev, CEDTextCell& cell) noexcept;
+        // remove cell
+        void Remove(CEDTextCell& cell) noexcept;
+        // rebuild index from all cells in (head, tail) in O(n)
+        void Build(const Node& head, const Node& tail) noexcept;
+        // string length of cell changed
+        void Update(CEDTextCell& cell, int32_t delta) noexcept;
+        // cell moved to new address
+        void Relocate(const CEDTextCell& from, CEDTextCell& to) noexcept;
+        // string length before cell
+        auto Prefix(const CEDTextCell& cell) const noexcept->uint32_t;
+        // find first cell ends at or after pos(pos > 0), offset = pos in cell
+        auto Find(uint32_t pos, uint32_t& offset) const noexcept->CEDTextCell*;
+        // total string length
+        auto GetTotal() const noexcept->uint32_t;
+    private:
+        // rotate node up over its parent
+        void rotate_up(CEDTextCell& node) noexcept;
+        // replace child of parent
+        void replace_child(CEDTextCell* parent, const CEDTextCell* old, CEDTextCell* now) noexcept;
+        // next priority
+        auto next_priority() noexcept->uint32_t;
+    private:
+        // root node
+        CEDTextCell*        m_pRoot = nullptr;
+        // random seed
+        uint32_t            m_uSeed = 0x9e3779b9;
+    };
+    // height index: fenwick tree over heights of visual lines,
+    // offset of visual line = prefix sum of heights before it.
+    // only offset/height queries and single-line Set are O(log n): visual
+    // lines are a flat array indexed by position, so a change of their
+    // count before the clean tail moves the tail and Rebuilds it in O(tail)
+    class CEDHeightIndex {
+    public:
+        // ctor
+        CEDHeightIndex() noexcept {}
+        // no copy ctor
+        CEDHeightIndex(const CEDHeightIndex&) noexcept = delete;
+        // set height of line, index <= count
+        bool Set(uint32_t index, unit_t height, IEDTextPlatform&) noexcept;
+        // rebuild lines in [begin, end) in O(end - begin), [begin, gap) as zero height
+        bool Rebuild(uint32_t begin, uint32_t gap, uint32_t end, const VisualLine* lines, IEDTextPlatform&) noexcept;
+        // sum of heights in [0, count)
+        auto Prefix(uint32_t count) const noexcept->unit_t;
+        // max count that prefix sum of heights <= offset
+        auto Find(unit_t offset) const noexcept->uint32_t;
+        // get count of lines
+        auto GetCount() const noexcept { return m_vTree.GetSize(); }
+        // get capacity
+        auto GetCapacity() const noexcept { return m_vTree.GetCapacity(); }
+    private:
+        // tree node, 1-based
+        auto&node(uint32_t i) noexcept { return m_vTree[i - 1]; }
+        // tree node, 1-based
+        auto node(uint32_t i) const noexcept { return m_vTree[i - 1]; }
+        // resize
+        bool resize(uint32_t count, IEDTextPlatform&) noexcept;
+    private:
+        // tree data
+        CEDBuffer<unit_t>   m_vTree;
+    };
+}
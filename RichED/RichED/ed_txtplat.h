@@ -32,6 +32,12 @@ namespace RichED {
     // cell
     class CEDTextCell;
     // text platform
+    // thread: calls come from the thread that owns the document, or from the background
+    // layout thread while the owner is paused (never at the same time), so no thread affinity.
+    // with Flag_ThreadSafePlatform, LayoutAll also calls RecreateContext, HitTest,
+    // GetCharMetrics and OnOOM concurrently from several threads, each cell only from
+    // one thread at a time; DeleteContext is serialized by the document.
+    // without the flag, LayoutAll never runs platform calls concurrently.
     struct PCN_NOVTABLE IEDTextPlatform {
         // on out of memory, won't be called on ctor
         virtual auto OnOOM(size_t retry_count, size_t try_alloc) noexcept ->HandleOOM = 0;
@@ -0,0 +1,147 @@
+﻿#include "ed_txtdoc.h"
+#include "ed_txtpool.h"
+#include <cstring>
+#include <cstddef>
+#include <cassert>
+#include <utility>
+
+// RichED::impl
+namespace RichED { namespace impl {
+    // pool config
+    enum : uint32_t {
+        // object alignment
+        POOL_ALIGN = alignof(double) > alignof(void*) ? alignof(double) : alignof(void*),
+        // object count of first chunk
+        POOL_CHUNK_MIN = 16,
+        // max object count of a chunk
+        POOL_CHUNK_MAX = 256,
+    };
+    // align size
+    inline uint32_t pool_align(uint32_t size) noexcept {
+        return (size + POOL_ALIGN - 1) & ~uint32_t(POOL_ALIGN - 1);
+    }
+}}
+
+// chunk header
+struct RichED::CEDCellPool::Chunk {
+    // next chunk
+    Chunk*      next;
+    // padding for alignment
+    alignas(impl::POOL_ALIGN) char data[1];
+};
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CEDCellPool"/> class.
+/// </summary>
+/// <param name="size">The size.</param>
+RichED::CEDCellPool::CEDCellPool(uint32_t size) noexcept
+    : m_size(impl::pool_align(size < sizeof(FreeNode) ? sizeof(FreeNode) : size)),
+    m_cNext(impl::POOL_CHUNK_MIN) {
+}
+
+/// <summary>
+/// Releases all chunks.
+/// </summary>
+/// <returns></returns>
+void RichED::CEDCellPool::ReleaseAll() noexcept {
+    auto chunk = m_pChunk;
+    while (chunk) {
+        const auto node = chunk;
+        chunk = chunk->next;
+        RichED::Free(node);
+    }
+    m_pChunk = nullptr;
+    m_pFree = nullptr;
+    m_pBump = m_pEnd = nullptr;
+    m_cbChunk = 0;
+    m_cNext = impl::POOL_CHUNK_MIN;
+}
+
+/// <summary>
+/// Swaps chunks with the specified pool.
+/// </summary>
+/// <param name="other">The other.</param>
+/// <returns></returns>
+void RichED::CEDCellPool::Swap(CEDCellPool& other) noexcept {
+    assert(m_size == other.m_size && "same object size");
+    std::swap(m_pFree, other.m_pFree);
+    std::swap(m_pChunk, other.m_pChunk);
+    std::swap(m_pBump, other.m_pBump);
+    std::swap(m_pEnd, other.m_pEnd);
+    std::swap(m_cbChunk, other.m_cbChunk);
+    std::swap(m_cNext, other.m_cNext);
+}
+
+PCN_NOINLINE
+/// <summary>
+/// Allocs an object.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+void* RichED::CEDCellPool::Alloc(CEDTextDocument& doc) noexcept {
+    // 当前块已经用完: Reserve预留的范围用完之前不会使用空闲链表
+    if (m_pBump == m_pEnd) {
+        // 其次使用空闲链表
+        if (const auto node = m_pFree) {
+            m_pFree = node->next;
+            return node;
+        }
+        if (!this->new_chunk(doc, m_cNext)) return nullptr;
+        // 下一块翻倍
+        if (m_cNext < impl::POOL_CHUNK_MAX) m_cNext *= 2;
+    }
+    const auto ptr = m_pBump;
+    m_pBump += m_size;
+    return ptr;
+}
+
+/// <summary>
+/// Allocs a new chunk as bump range.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="count">The object count.</param>
+/// <returns></returns>
+bool RichED::CEDCellPool::new_chunk(CEDTextDocument& doc, uint32_t count) noexcept {
+    const size_t len = offsetof(Chunk, data) + size_t(m_size) * count;
+    const auto chunk = static_cast<Chunk*>(doc.Alloc(len));
+    if (!chunk) return false;
+    m_cbChunk += len;
+    chunk->next = m_pChunk;
+    m_pChunk = chunk;
+    m_pBump = chunk->data;
+    m_pEnd = chunk->data + size_t(m_size) * count;
+    return true;
+}
+
+/// <summary>
+/// Reserves objects in one chunk.
+/// </summary>
+/// <param name="doc">The document.</param>
+/// <param name="count">The object count.</param>
+/// <returns></returns>
+bool RichED::CEDCellPool::Reserve(CEDTextDocument& doc, uint32_t count) noexcept {
+    if (size_t(m_pEnd - m_pBump) >= size_t(m_size) * count) return true;
+    // 当前块剩余部分放入空闲链表
+    while (m_pBump != m_pEnd) {
+        const auto node = reinterpret_cast<FreeNode*>(m_pBump);
+        node->next = m_pFree;
+        m_pFree = node;
+        m_pBump += m_size;
+    }
+    return this->new_chunk(doc, count);
+}
+
+/// <summary>
+/// Frees the object.
+/// </summary>
+/// <param name="ptr">The PTR.</param>
+/// <returns></returns>
+void RichED::CEDCellPool::Free(void* ptr) noexcept {
+    if (!ptr) return;
+#ifndef NDEBUG
+    std::memset(ptr, 0xfd, m_size);
+#endif
+    const auto node = static_cast<FreeNode*>(ptr);
+    node->next = m_pFree;
+    m_pFree = node;
+}
@@ -0,0 +1,80 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstddef>
+
+// RichED namespace
+namespace RichED {
+    // text document
+    class CEDTextDocument;
+    // cell pool: fixed-size slab allocator with free-list
+    class CEDCellPool {
+        // chunk header
+        struct Chunk;
+        // free node
+        struct FreeNode { FreeNode* next; };
+    public:
+        // ctor
+        CEDCellPool(uint32_t size) noexcept;
+        // dtor
+        ~CEDCellPool() noexcept { this->ReleaseAll(); }
+        // no copy ctor
+        CEDCellPool(const CEDCellPool&) noexcept = delete;
+        // alloc an object from bump range first then free-list, return nullptr if oom
+        void*Alloc(CEDTextDocument&) noexcept;
+        // free an object
+        void Free(void*) noexcept;
+        // reserve objects in one chunk, next count allocs take them in order, return false if oom
+        bool Reserve(CEDTextDocument&, uint32_t count) noexcept;
+        // release all chunks, objects inside will be invalid
+        void ReleaseAll() noexcept;
+        // swap chunks with other pool of same object size
+        void Swap(CEDCellPool&) noexcept;
+        // get object size
+        auto GetObjectSize() const noexcept { return m_size; }
+        // get bytes of all chunks
+        auto GetChunkBytes() const noexcept { return m_cbChunk; }
+    private:
+        // alloc new chunk as bump range
+        bool new_chunk(CEDTextDocument&, uint32_t count) noexcept;
+    private:
+        // free list
+        FreeNode*           m_pFree = nullptr;
+        // chunk list, newest first
+        Chunk*              m_pChunk = nullptr;
+        // bump pointer in newest chunk
+        char*               m_pBump = nullptr;
+        // end of newest chunk
+        char*               m_pEnd = nullptr;
+        // bytes of all chunks
+        size_t              m_cbChunk = 0;
+        // object size, aligned
+        uint32_t      const m_size;
+        // object count of next chunk
+        uint32_t            m_cNext;
+    };
+}
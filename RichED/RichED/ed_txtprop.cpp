@@ -0,0 +1,1358 @@
+﻿#include "ed_config.h"
+#include "ed_txtprop.h"
+#include <cassert>
+
+// unicode properties as three-stage trie [ch >> 9][(ch >> 4) & 31][ch & 15],
+// generated from UCD (Unicode 14.0): LineBreak, EastAsianWidth, DerivedGeneralCategory,
+// GraphemeBreakProperty, WordBreakProperty and emoji-data (Extended_Pictographic).
+// line break classes resolved as CEDLineBreaker expects [LB1]:
+// AI/SG/XX as AL, SA as CM (Mn/Mc) or AL, CJ as NS.
+// regenerate: perl tools/ucd_dump.pl <dir> && python3 tools/ucd_tables.py <dir> RichED/ed_txtprop.cpp
+// record of properties
+static constexpr uint32_t RED_PROP_RECORD[] = {
+    0x1900D5, 0x1900D1, 0x1910A3, 0x1918E1, 0x190862, 0xB69025, 0xB10006, 0xB16003,
+    0xB1000C, 0xB30009, 0xB1000A, 0xB15803, 0xAD0000, 0xAE0002, 0xB20009, 0xB17808,
+    0xAC0010, 0xB16808, 0xB10007, 0xA8800B, 0xB17008, 0xB2000C, 0xA0500C, 0xB10009,
+    0xB4000C, 0xAB880C, 0xA1500C, 0xB20011, 0xAE0001, 0x1918E4, 0x160004, 0x310000,
+    0xB3000A, 0x330009, 0xB5000C, 0x31000C, 0x34000C, 0x15040C, 0x24500C, 0x0F0003,
+    0x3A38D1, 0x35040C, 0x35000A, 0x320009, 0x2A000C, 0x340012, 0x01500C, 0x31700C,
+    0x100003, 0x00500C, 0x20500C, 0x32000C, 0x21500C, 0x04500C, 0x02500C, 0x03500C,
+    0x14500C, 0x34500C, 0x23500C, 0x035012, 0x14000C, 0x345012, 0x252115, 0x252104,
+    0x1D000C, 0x117808, 0x11700C, 0x12000C, 0x15000C, 0x052115, 0x072115, 0x11500C,
+    0x11000C, 0x0C5011, 0x130009, 0x0C0011, 0x110006, 0x04480D, 0x1A39CC, 0x11000A,
+    0x13000A, 0x1A38D5, 0x08800B, 0x11800B, 0x11780B, 0x062215, 0x110011, 0x062115,
+    0x0A000C, 0x0A000A, 0x110012, 0x0451CC, 0x15000A, 0x04000C, 0x04020C, 0x03000C,
+    0x150012, 0x110004, 0x150011, 0x0D0000, 0x0E0001, 0x062211, 0x062015, 0x645259,
+    0x04529A, 0x0452DB, 0x169011, 0x09500C, 0x110005, 0x0C0012, 0x1A38C4, 0x140012,
+    0x1A00D4, 0x1A2115, 0x1A295F, 0x2C0011, 0x0C0004, 0x2C0013, 0x2C000C, 0x2F6803,
+    0x306803, 0x2F0003, 0x300003, 0x31680F, 0x31000F, 0x317011, 0x1718E1, 0x1818E1,
+    0x168804, 0x31000A, 0x110405, 0x0B880C, 0x127808, 0x1A38D6, 0x1A38CC, 0x1D00CC,
+    0x530009, 0x1D0009, 0x35000C, 0x350009, 0x01540C, 0x29500C, 0x32040C, 0x120009,
+    0x12000F, 0x75040E, 0x6D0000, 0x6E0001, 0x75040C, 0x15040E, 0x35500C, 0x35540C,
+    0x12040C, 0x72040C, 0x35040E, 0x15041D, 0x35041D, 0x75041D, 0x150003, 0x150006,
+    0x150406, 0x110003, 0x110000, 0x0C000C, 0x0C0013, 0x75000E, 0x969011, 0x710001,
+    0x71000E, 0x635005, 0x64000E, 0x69000E, 0x6C0005, 0x652115, 0x662115, 0x6C040E,
+    0x63400E, 0x634015, 0x645005, 0x71040E, 0x15000E, 0x640005, 0x744005, 0x630005,
+    0x6C4005, 0x644005, 0x64400E, 0x710005, 0x634005, 0x64500E, 0x6A000E, 0x75400E,
+    0x645317, 0x645358, 0x1B000C, 0x3C000C, 0x7D000E, 0x717808, 0x717008, 0x710006,
+    0x71000F, 0x6C000E, 0x6B880E, 0x717801, 0x716801, 0x717805, 0x717005, 0x72000E,
+    0x730009, 0x71000A, 0x910006, 0x91000E, 0x930009, 0x91000A, 0x91680E, 0x8D0000,
+    0x8E0001, 0x92000E, 0x917801, 0x8C000E, 0x916801, 0x88800E, 0x917005, 0x917805,
+    0x80500E, 0x94000E, 0x8B880E, 0x81500E, 0x510001, 0x4D0000, 0x4E0001, 0x510005,
+    0x44400E, 0x444005, 0x434005, 0x432105, 0x44500E, 0x93000A, 0x95000E, 0x55000C,
+    0x52000C, 0x150020, 0x11000F, 0x045000, 0x045001, 0x1A38C0, 0x1A38C1, 0x652104,
+    0x662215, 0x64000C, 0x63400C, 0x1D040E, 0x15319C, 0x74211E, 0x150005,
+};
+// stage 1: [ch >> 9] -> block of stage 2
+static constexpr uint8_t RED_PROP_STAGE1[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x22, 0x23, 0x24,
+    0x25, 0x26, 0x27, 0x28, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x43, 0x43, 0x43, 0x44, 0x40, 0x45, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x47, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x40, 0x49, 0x43, 0x4A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x4B, 0x1A, 0x4C, 0x4D, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4E, 0x4F, 0x50, 0x43, 0x43, 0x43, 0x43, 0x51, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x43, 0x59,
+    0x5A, 0x5B, 0x43, 0x5C, 0x5D, 0x43, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x68, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x69, 0x6A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x6B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x1A, 0x6E, 0x6D, 0x6F,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x70, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6F,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x73,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x73,
+};
+// stage 2: [block << 5 | (ch >> 4) & 31] -> block of stage 3
+static constexpr uint16_t RED_PROP_STAGE2[] = {
+    0x000, 0x001, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007, 0x008, 0x001, 0x009, 0x00A, 0x00B, 0x00C, 0x00D, 0x00E,
+    0x00F, 0x010, 0x011, 0x012, 0x013, 0x014, 0x011, 0x015, 0x016, 0x017, 0x018, 0x019, 0x01A, 0x01B, 0x01C, 0x01D,
+    0x01C, 0x01C, 0x01C, 0x01E, 0x01F, 0x020, 0x020, 0x021, 0x021, 0x022, 0x021, 0x023, 0x024, 0x025, 0x026, 0x027,
+    0x028, 0x028, 0x028, 0x028, 0x029, 0x02A, 0x02B, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x032, 0x01C, 0x033,
+    0x034, 0x035, 0x035, 0x036, 0x036, 0x020, 0x01C, 0x01C, 0x037, 0x01C, 0x01C, 0x01C, 0x038, 0x01C, 0x01C, 0x01C,
+    0x01C, 0x01C, 0x01C, 0x039, 0x03A, 0x03B, 0x021, 0x021, 0x03C, 0x03D, 0x03E, 0x03F, 0x040, 0x041, 0x042, 0x043,
+    0x044, 0x045, 0x046, 0x046, 0x047, 0x03E, 0x048, 0x049, 0x046, 0x046, 0x046, 0x046, 0x046, 0x04A, 0x04B, 0x04C,
+    0x04D, 0x04E, 0x046, 0x03E, 0x04F, 0x046, 0x046, 0x046, 0x046, 0x046, 0x050, 0x051, 0x052, 0x046, 0x053, 0x054,
+    0x046, 0x055, 0x056, 0x057, 0x046, 0x058, 0x059, 0x046, 0x05A, 0x05B, 0x046, 0x046, 0x05C, 0x03E, 0x05D, 0x03E,
+    0x05E, 0x046, 0x046, 0x05F, 0x060, 0x061, 0x062, 0x063, 0x064, 0x065, 0x066, 0x067, 0x068, 0x069, 0x06A, 0x06B,
+    0x06C, 0x065, 0x066, 0x06D, 0x06E, 0x06F, 0x070, 0x071, 0x072, 0x073, 0x066, 0x074, 0x075, 0x076, 0x06A, 0x077,
+    0x078, 0x065, 0x066, 0x079, 0x07A, 0x07B, 0x06A, 0x07C, 0x07D, 0x07E, 0x07F, 0x080, 0x081, 0x082, 0x070, 0x083,
+    0x084, 0x085, 0x066, 0x086, 0x087, 0x088, 0x06A, 0x089, 0x08A, 0x085, 0x066, 0x08B, 0x08C, 0x08D, 0x06A, 0x08E,
+    0x08F, 0x085, 0x046, 0x090, 0x091, 0x092, 0x06A, 0x093, 0x094, 0x095, 0x046, 0x096, 0x097, 0x098, 0x070, 0x099,
+    0x09A, 0x09B, 0x09B, 0x09C, 0x09D, 0x09E, 0x09F, 0x09F, 0x0A0, 0x09B, 0x0A1, 0x0A2, 0x0A3, 0x0A4, 0x09F, 0x09F,
+    0x0A5, 0x0A6, 0x0A7, 0x0A8, 0x0A9, 0x046, 0x0AA, 0x0AB, 0x0AC, 0x0AD, 0x03E, 0x0AE, 0x0AF, 0x0B0, 0x09F, 0x09F,
+    0x09B, 0x09B, 0x0B1, 0x0B2, 0x0B3, 0x0B4, 0x0B5, 0x0B6, 0x0B7, 0x0B8, 0x03A, 0x03A, 0x0B9, 0x021, 0x021, 0x0BA,
+    0x0BB, 0x0BB, 0x0BB, 0x0BB, 0x0BB, 0x0BB, 0x0BC, 0x0BC, 0x0BC, 0x0BC, 0x0BD, 0x0BE, 0x0BE, 0x0BE, 0x0BE, 0x0BE,
+    0x046, 0x046, 0x046, 0x046, 0x0BF, 0x0C0, 0x046, 0x046, 0x0BF, 0x046, 0x046, 0x0C1, 0x0C2, 0x0C3, 0x046, 0x046,
+    0x046, 0x0C2, 0x046, 0x046, 0x046, 0x0C4, 0x0C5, 0x0C6, 0x046, 0x0C7, 0x03A, 0x03A, 0x03A, 0x03A, 0x03A, 0x0C8,
+    0x0C9, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x0CA, 0x046, 0x0CB, 0x0CC, 0x046, 0x046, 0x046, 0x046, 0x0CD, 0x0CE,
+    0x046, 0x0CF, 0x046, 0x0D0, 0x046, 0x0D1, 0x0D2, 0x0D3, 0x09B, 0x09B, 0x09B, 0x0D4, 0x0D5, 0x0D6, 0x0D7, 0x0D8,
+    0x0D9, 0x0D7, 0x046, 0x046, 0x0DA, 0x046, 0x046, 0x0DB, 0x0DC, 0x046, 0x0DD, 0x046, 0x046, 0x046, 0x046, 0x0DE,
+    0x046, 0x0DF, 0x0E0, 0x0E1, 0x0E2, 0x09B, 0x0E3, 0x0E4, 0x09B, 0x09B, 0x0E5, 0x09B, 0x0E6, 0x0E7, 0x0E8, 0x0E8,
+    0x046, 0x0E9, 0x09B, 0x09B, 0x09B, 0x0EA, 0x0EB, 0x0EC, 0x0D7, 0x0D7, 0x0ED, 0x0EE, 0x0EF, 0x09F, 0x09F, 0x09F,
+    0x0F0, 0x046, 0x046, 0x0F1, 0x0F2, 0x0F3, 0x0F4, 0x0F5, 0x0F6, 0x046, 0x0F7, 0x052, 0x046, 0x046, 0x0F8, 0x0F9,
+    0x046, 0x046, 0x0FA, 0x0FB, 0x0FC, 0x052, 0x046, 0x0FD, 0x0FE, 0x03A, 0x03A, 0x0FF, 0x100, 0x101, 0x102, 0x103,
+    0x021, 0x021, 0x104, 0x023, 0x023, 0x023, 0x105, 0x106, 0x021, 0x107, 0x023, 0x023, 0x03E, 0x03E, 0x03E, 0x03E,
+    0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x108, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C,
+    0x109, 0x10A, 0x109, 0x109, 0x10A, 0x10B, 0x109, 0x10C, 0x10D, 0x10D, 0x10D, 0x10E, 0x10F, 0x110, 0x111, 0x112,
+    0x113, 0x114, 0x115, 0x116, 0x117, 0x118, 0x119, 0x11A, 0x11B, 0x11C, 0x11D, 0x11E, 0x11F, 0x120, 0x121, 0x122,
+    0x123, 0x124, 0x125, 0x126, 0x127, 0x128, 0x129, 0x12A, 0x12B, 0x12C, 0x12D, 0x12E, 0x12F, 0x130, 0x131, 0x132,
+    0x133, 0x134, 0x135, 0x136, 0x137, 0x138, 0x139, 0x13A, 0x13B, 0x13C, 0x13D, 0x13E, 0x13A, 0x13A, 0x13F, 0x13A,
+    0x140, 0x141, 0x142, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x143, 0x144, 0x145, 0x13A, 0x146, 0x147, 0x148, 0x149, 0x14A,
+    0x0E8, 0x0E8, 0x14B, 0x09F, 0x14C, 0x09F, 0x14D, 0x14D, 0x14D, 0x14E, 0x14F, 0x150, 0x151, 0x152, 0x153, 0x14D,
+    0x14F, 0x14F, 0x14F, 0x14F, 0x154, 0x14F, 0x14F, 0x155, 0x14F, 0x156, 0x157, 0x158, 0x159, 0x15A, 0x15B, 0x15C,
+    0x15D, 0x15E, 0x15F, 0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167, 0x168, 0x169, 0x16A, 0x16B, 0x16C,
+    0x16D, 0x16E, 0x16F, 0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177, 0x178, 0x179, 0x13A, 0x17A, 0x13A,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8,
+    0x13A, 0x13A, 0x13A, 0x17B, 0x13A, 0x13A, 0x13A, 0x13A, 0x17C, 0x17D, 0x13A, 0x13A, 0x13A, 0x17E, 0x13A, 0x17F,
+    0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A, 0x13A,
+    0x180, 0x181, 0x0E8, 0x13A, 0x182, 0x183, 0x0E8, 0x184, 0x0E8, 0x185, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8,
+    0x03A, 0x03A, 0x03A, 0x021, 0x021, 0x021, 0x186, 0x187, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x01C, 0x188, 0x189,
+    0x021, 0x021, 0x18A, 0x046, 0x046, 0x046, 0x18B, 0x18C, 0x046, 0x18D, 0x18E, 0x18E, 0x18E, 0x18E, 0x03E, 0x03E,
+    0x18F, 0x190, 0x191, 0x192, 0x193, 0x194, 0x09F, 0x09F, 0x195, 0x196, 0x195, 0x195, 0x195, 0x195, 0x195, 0x197,
+    0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x198, 0x09F, 0x199,
+    0x19A, 0x19B, 0x19C, 0x19D, 0x19E, 0x19F, 0x1A0, 0x19F, 0x1A1, 0x1A2, 0x1A3, 0x1A4, 0x1A5, 0x1A4, 0x1A6, 0x1A7,
+    0x1A8, 0x1A9, 0x1A9, 0x1AA, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1AB, 0x1AC, 0x1A9, 0x1A9, 0x195, 0x195, 0x197, 0x1AD,
+    0x195, 0x1AE, 0x1AF, 0x195, 0x1B0, 0x1B1, 0x195, 0x195, 0x1AF, 0x1B2, 0x195, 0x1B1, 0x195, 0x1B3, 0x1B3, 0x1B4,
+    0x1B3, 0x1B3, 0x1B3, 0x1B3, 0x1B3, 0x1B5, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195, 0x195,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x0E8, 0x0E8, 0x0E8, 0x0E8,
+    0x1A9, 0x1B6, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9,
+    0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9,
+    0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9,
+    0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9,
+    0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1A9, 0x1B7, 0x195, 0x195, 0x195, 0x1B8, 0x046, 0x046, 0x0FD,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x1B9, 0x046, 0x1BA, 0x09F, 0x01C, 0x01C, 0x1BB, 0x1BC, 0x01C, 0x1BD, 0x046, 0x046, 0x046, 0x046, 0x1BE, 0x1BF,
+    0x1C0, 0x1C1, 0x1C2, 0x1C3, 0x01C, 0x01C, 0x01C, 0x1C4, 0x1C5, 0x1C6, 0x1C7, 0x1C8, 0x1C9, 0x1CA, 0x09F, 0x1CB,
+    0x1CC, 0x046, 0x1CD, 0x1CE, 0x046, 0x046, 0x046, 0x1CF, 0x1D0, 0x046, 0x046, 0x1D1, 0x1D2, 0x0D7, 0x03E, 0x1D3,
+    0x052, 0x046, 0x1D4, 0x046, 0x1D5, 0x1D6, 0x0BB, 0x1D7, 0x05E, 0x046, 0x046, 0x1D8, 0x1D9, 0x1DA, 0x1DB, 0x1DC,
+    0x046, 0x046, 0x1DD, 0x1DE, 0x1DF, 0x1E0, 0x09B, 0x1E1, 0x09B, 0x09B, 0x09B, 0x1E2, 0x1E3, 0x1E4, 0x1E5, 0x1E6,
+    0x1E7, 0x1E8, 0x18E, 0x021, 0x021, 0x1E9, 0x1EA, 0x021, 0x021, 0x021, 0x021, 0x021, 0x046, 0x046, 0x1EB, 0x0D7,
+    0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED,
+    0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF,
+    0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0,
+    0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC,
+    0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE,
+    0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE,
+    0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE,
+    0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED,
+    0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF,
+    0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0,
+    0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC,
+    0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE,
+    0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE,
+    0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE,
+    0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED,
+    0x1EE, 0x1EF, 0x1EE, 0x1F0, 0x1EE, 0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1EE, 0x1F1, 0x0BC, 0x1F2, 0x0BE, 0x0BE, 0x1F3,
+    0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4,
+    0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4, 0x1F4,
+    0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5,
+    0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5,
+    0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x1F6, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x1F7, 0x1F8, 0x1F8,
+    0x1F9, 0x1FA, 0x1FB, 0x1FC, 0x1FD, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x1FE, 0x1FF, 0x200, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x201, 0x0E8, 0x046, 0x046, 0x046, 0x046, 0x202, 0x046, 0x046, 0x203, 0x09F, 0x09F, 0x204,
+    0x028, 0x205, 0x03E, 0x206, 0x207, 0x208, 0x209, 0x20A, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x20B,
+    0x20C, 0x20D, 0x20E, 0x20F, 0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217, 0x218, 0x219, 0x21A, 0x21B,
+    0x21C, 0x046, 0x0C3, 0x21D, 0x21E, 0x21E, 0x09F, 0x09F, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x059,
+    0x21F, 0x175, 0x175, 0x220, 0x221, 0x221, 0x221, 0x222, 0x223, 0x224, 0x225, 0x09F, 0x09F, 0x0E8, 0x0E8, 0x226,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x0AA, 0x046, 0x046, 0x046, 0x076, 0x227, 0x228,
+    0x046, 0x046, 0x229, 0x046, 0x22A, 0x046, 0x046, 0x22B, 0x046, 0x22C, 0x046, 0x046, 0x22D, 0x22E, 0x09F, 0x09F,
+    0x03A, 0x03A, 0x22F, 0x021, 0x021, 0x046, 0x046, 0x046, 0x046, 0x21E, 0x0D7, 0x03A, 0x03A, 0x230, 0x021, 0x231,
+    0x046, 0x046, 0x232, 0x046, 0x046, 0x046, 0x233, 0x234, 0x234, 0x235, 0x236, 0x237, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x18D, 0x046, 0x0DE, 0x232, 0x09F, 0x238, 0x023, 0x023, 0x239, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x23A, 0x046, 0x046, 0x23B, 0x046, 0x23C, 0x046, 0x23D, 0x046, 0x0DF, 0x23E, 0x09F, 0x09F, 0x09F, 0x046, 0x23F,
+    0x046, 0x240, 0x046, 0x241, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x046, 0x046, 0x242, 0x175, 0x243, 0x175, 0x175,
+    0x244, 0x245, 0x046, 0x246, 0x247, 0x248, 0x046, 0x249, 0x046, 0x24A, 0x09F, 0x09F, 0x24B, 0x046, 0x24C, 0x24D,
+    0x046, 0x046, 0x046, 0x24E, 0x046, 0x24F, 0x046, 0x250, 0x046, 0x251, 0x252, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x046, 0x0DB, 0x09F, 0x09F, 0x09F, 0x03A, 0x03A, 0x03A, 0x253, 0x021, 0x021, 0x021, 0x254,
+    0x046, 0x046, 0x255, 0x0D7, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x175, 0x256, 0x046, 0x046, 0x257, 0x258, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x24A, 0x259, 0x046, 0x050, 0x25A, 0x09F, 0x046, 0x25B, 0x09F, 0x09F, 0x046, 0x25C, 0x09F, 0x046, 0x18D,
+    0x25D, 0x046, 0x046, 0x25E, 0x25F, 0x243, 0x260, 0x261, 0x0F6, 0x046, 0x046, 0x262, 0x263, 0x046, 0x0DB, 0x0D7,
+    0x264, 0x046, 0x265, 0x266, 0x267, 0x046, 0x046, 0x268, 0x0F6, 0x046, 0x046, 0x269, 0x26A, 0x26B, 0x26C, 0x26D,
+    0x046, 0x073, 0x26E, 0x26F, 0x09F, 0x09F, 0x09F, 0x09F, 0x270, 0x271, 0x272, 0x046, 0x046, 0x273, 0x274, 0x0D7,
+    0x275, 0x065, 0x066, 0x276, 0x277, 0x278, 0x279, 0x27A, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x27B, 0x27C, 0x27D, 0x258, 0x09F, 0x046, 0x046, 0x046, 0x27E, 0x27F, 0x0D7, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x046, 0x280, 0x281, 0x282, 0x283, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x284, 0x285, 0x0D7, 0x286, 0x09F, 0x046, 0x046, 0x287, 0x288, 0x0D7, 0x09F, 0x09F, 0x09F,
+    0x09B, 0x289, 0x28A, 0x28B, 0x28C, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x26E, 0x28D, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x03A, 0x03A, 0x021, 0x021, 0x0A7, 0x28E,
+    0x28F, 0x290, 0x046, 0x291, 0x292, 0x0D7, 0x09F, 0x09F, 0x09F, 0x09F, 0x293, 0x046, 0x046, 0x294, 0x295, 0x09F,
+    0x296, 0x046, 0x046, 0x297, 0x298, 0x299, 0x046, 0x046, 0x29A, 0x29B, 0x29C, 0x046, 0x046, 0x046, 0x046, 0x0DB,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x066, 0x046, 0x29D, 0x29E, 0x29F, 0x0A7, 0x0C6, 0x2A0, 0x046, 0x2A1, 0x2A2, 0x2A3, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x2A4, 0x046, 0x046, 0x2A5, 0x2A6, 0x0D7, 0x2A7, 0x046, 0x2A8, 0x2A9, 0x0D7, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x2AA,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x076, 0x175, 0x2AB, 0x2AC, 0x2AD,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x2AE, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x221, 0x221, 0x221, 0x221, 0x221, 0x221, 0x2AF, 0x2B0, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x2B1, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x2B2,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x2B3, 0x046, 0x046, 0x2B4, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x2B5, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x0DF, 0x2B6, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x2B7, 0x046, 0x046, 0x046,
+    0x046, 0x046, 0x046, 0x046, 0x18D, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x0DB, 0x046, 0x0DF, 0x2B8, 0x046, 0x046, 0x046, 0x046, 0x0DF, 0x0D7, 0x046, 0x21E, 0x2B9,
+    0x046, 0x046, 0x046, 0x2BA, 0x2BB, 0x2BC, 0x2BD, 0x2BE, 0x046, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x03A, 0x03A, 0x021, 0x021, 0x175, 0x2BF, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x046, 0x2C0, 0x2C1, 0x2C2, 0x2C2, 0x2C3, 0x2C4, 0x09F, 0x09F, 0x09F, 0x09F, 0x2C5, 0x2C6,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x2C7,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8,
+    0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C8, 0x2C9, 0x09F, 0x09F,
+    0x2CA, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x2CB,
+    0x2CC, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x2CD, 0x09F, 0x09F, 0x2CE, 0x2CF, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x2D0,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x059, 0x0AA, 0x0DB, 0x2D1, 0x2D2, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x03E, 0x03E, 0x2D3, 0x03E, 0x2D4, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x2D5, 0x09F, 0x09F, 0x09F,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x2D6,
+    0x0E8, 0x0E8, 0x2D7, 0x0E8, 0x0E8, 0x0E8, 0x2D8, 0x2D9, 0x2DA, 0x0E8, 0x2DB, 0x0E8, 0x0E8, 0x0E8, 0x14C, 0x09F,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x2DC, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x175, 0x2DD,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x14B, 0x175, 0x247, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x03A, 0x2DE, 0x021, 0x2DF, 0x2E0, 0x2E1, 0x109, 0x03A, 0x2E2, 0x2E3, 0x2E4, 0x2E5, 0x2E6, 0x03A, 0x2DE, 0x021,
+    0x2E7, 0x2E8, 0x021, 0x2E9, 0x2EA, 0x2EB, 0x2EC, 0x03A, 0x2ED, 0x021, 0x03A, 0x2DE, 0x021, 0x2DF, 0x2E0, 0x021,
+    0x109, 0x03A, 0x2E2, 0x2EC, 0x03A, 0x2ED, 0x021, 0x03A, 0x2DE, 0x021, 0x2EE, 0x03A, 0x2EF, 0x2F0, 0x2F1, 0x2F2,
+    0x021, 0x2F3, 0x03A, 0x2F4, 0x2F5, 0x2F6, 0x2F7, 0x021, 0x2F8, 0x03A, 0x2F9, 0x021, 0x2FA, 0x2FB, 0x2FB, 0x2FB,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8,
+    0x03E, 0x03E, 0x03E, 0x2FC, 0x03E, 0x03E, 0x2FD, 0x2FE, 0x2FF, 0x300, 0x03D, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x301, 0x302, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x303, 0x304, 0x305, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x046, 0x046, 0x0AA, 0x306, 0x307, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x046, 0x308, 0x09F, 0x046, 0x046, 0x309, 0x30A,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x30B, 0x0DF,
+    0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x046, 0x30C, 0x2D4, 0x09F, 0x09F,
+    0x03A, 0x03A, 0x2E2, 0x021, 0x30D, 0x30E, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x26C, 0x175, 0x175, 0x30F, 0x310, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x26C, 0x175, 0x311, 0x312, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x313, 0x046, 0x314, 0x315, 0x316, 0x317, 0x318, 0x319, 0x31A, 0x31B, 0x31C, 0x31B, 0x09F, 0x09F, 0x09F, 0x31D,
+    0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F, 0x09F,
+    0x31E, 0x31F, 0x320, 0x31F, 0x31F, 0x31F, 0x31F, 0x31F, 0x31F, 0x321, 0x322, 0x323, 0x324, 0x323, 0x31F, 0x325,
+    0x326, 0x14F, 0x327, 0x152, 0x328, 0x152, 0x329, 0x32A, 0x32B, 0x32C, 0x32D, 0x32E, 0x32E, 0x32E, 0x32F, 0x330,
+    0x331, 0x332, 0x333, 0x334, 0x335, 0x336, 0x337, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E,
+    0x338, 0x338, 0x339, 0x33A, 0x338, 0x338, 0x338, 0x33B, 0x33C, 0x33D, 0x338, 0x33E, 0x33F, 0x340, 0x338, 0x341,
+    0x338, 0x338, 0x338, 0x342, 0x343, 0x344, 0x345, 0x346, 0x347, 0x348, 0x349, 0x34A, 0x338, 0x338, 0x338, 0x34B,
+    0x34C, 0x34D, 0x34E, 0x34F, 0x350, 0x338, 0x351, 0x352, 0x31F, 0x353, 0x31E, 0x31F, 0x31F, 0x354, 0x31F, 0x355,
+    0x338, 0x338, 0x338, 0x338, 0x356, 0x0E8, 0x0E8, 0x357, 0x338, 0x338, 0x358, 0x359, 0x35A, 0x35B, 0x35C, 0x35D,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x35E, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x35F, 0x360, 0x361,
+    0x362, 0x0E8, 0x0E8, 0x0E8, 0x363, 0x364, 0x0E8, 0x0E8, 0x363, 0x0E8, 0x365, 0x366, 0x32E, 0x32E, 0x32E, 0x32E,
+    0x367, 0x368, 0x369, 0x36A, 0x36B, 0x338, 0x338, 0x36C, 0x338, 0x338, 0x338, 0x36D, 0x36E, 0x36F, 0x338, 0x338,
+    0x15F, 0x15F, 0x15F, 0x15F, 0x15F, 0x370, 0x371, 0x372, 0x373, 0x338, 0x374, 0x375, 0x376, 0x377, 0x378, 0x379,
+    0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x0E8, 0x37A, 0x0E8, 0x0E8, 0x14C, 0x09F, 0x09F, 0x0D7,
+    0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E,
+    0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E,
+    0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E,
+    0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x32E, 0x37B,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x1F8, 0x1F8,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x37C, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x1F6, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x37D, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x37E, 0x1F8,
+    0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x19F, 0x1F6, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x37F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F, 0x19F,
+    0x19F, 0x19F, 0x19F, 0x19F, 0x380, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8, 0x1F8,
+    0x381, 0x382, 0x383, 0x383, 0x383, 0x383, 0x383, 0x383, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382,
+    0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x028, 0x382,
+    0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382,
+    0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382, 0x382,
+    0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5,
+    0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x1F5, 0x384,
+};
+// stage 3: [block << 4 | ch & 15] -> record
+static constexpr uint8_t RED_PROP_STAGE3[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x08, 0x0B, 0x0C, 0x0D, 0x08, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x14, 0x0F, 0x15, 0x15, 0x15, 0x06,
+    0x08, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0C, 0x17, 0x0D, 0x18, 0x19,
+    0x18, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x0C, 0x1B, 0x1C, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x1F, 0x20, 0x09, 0x21, 0x09, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x15, 0x28, 0x29, 0x18,
+    0x2A, 0x2B, 0x2C, 0x2C, 0x2D, 0x2E, 0x23, 0x2F, 0x24, 0x2C, 0x26, 0x30, 0x2C, 0x2C, 0x2C, 0x1F,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x34,
+    0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x34, 0x2E, 0x34, 0x34, 0x34, 0x2E, 0x34, 0x34, 0x2E, 0x2E,
+    0x34, 0x2E, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x33, 0x34, 0x34, 0x34, 0x2E, 0x34, 0x2E, 0x34, 0x2E,
+    0x31, 0x34, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x34, 0x31, 0x34, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x34, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x32, 0x34, 0x31, 0x2E, 0x31, 0x34, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x34, 0x32, 0x34, 0x31, 0x2E, 0x31, 0x2E, 0x34, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x32,
+    0x34, 0x32, 0x34, 0x31, 0x34, 0x31, 0x2E, 0x31, 0x34, 0x34, 0x32, 0x34, 0x31, 0x34, 0x31, 0x2E,
+    0x31, 0x2E, 0x32, 0x34, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x2E,
+    0x2E, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x31, 0x31,
+    0x31, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x2E, 0x31,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x31,
+    0x2E, 0x31, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x2E, 0x35, 0x31, 0x2E, 0x2E, 0x2E,
+    0x35, 0x35, 0x35, 0x35, 0x31, 0x36, 0x2E, 0x31, 0x36, 0x2E, 0x31, 0x36, 0x2E, 0x31, 0x34, 0x31,
+    0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x34, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x2E, 0x31, 0x36, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x31, 0x2E,
+    0x2E, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x2E, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x35, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x38, 0x38, 0x39, 0x38, 0x37, 0x3A, 0x3B, 0x3A, 0x3A, 0x3A, 0x3B, 0x3A, 0x37, 0x37,
+    0x3A, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x24, 0x24, 0x24, 0x24, 0x3C, 0x24, 0x38, 0x3D,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x31, 0x2E, 0x31, 0x2E, 0x37, 0x3C, 0x31, 0x2E, 0x40, 0x40, 0x37, 0x2E, 0x2E, 0x2E, 0x41, 0x31,
+    0x40, 0x40, 0x40, 0x40, 0x3C, 0x3C, 0x31, 0x42, 0x31, 0x31, 0x31, 0x40, 0x31, 0x40, 0x31, 0x31,
+    0x2E, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x40, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x34, 0x34, 0x2E, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31,
+    0x2E, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x2E, 0x43, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x2E, 0x31, 0x31, 0x31,
+    0x31, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x31, 0x2E, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x2E,
+    0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x40, 0x37, 0x47, 0x47, 0x47, 0x48, 0x47, 0x42,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x41, 0x49, 0x40, 0x40, 0x44, 0x44, 0x4A,
+    0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4B, 0x45,
+    0x48, 0x45, 0x45, 0x48, 0x45, 0x45, 0x4C, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x40, 0x40, 0x40, 0x40, 0x4D,
+    0x4D, 0x4D, 0x4D, 0x47, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x43, 0x43, 0x43, 0x4F, 0x4F, 0x50, 0x41, 0x41, 0x44, 0x44,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4C, 0x51, 0x4C, 0x4C, 0x4C,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x37, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4F, 0x53, 0x54, 0x48, 0x35, 0x35,
+    0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x4C, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4E, 0x44, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x37, 0x37, 0x45, 0x45, 0x44, 0x45, 0x45, 0x45, 0x45, 0x35, 0x35,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x35, 0x35, 0x35, 0x44, 0x44, 0x35,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40, 0x4E,
+    0x35, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x37, 0x37, 0x44, 0x48, 0x41, 0x4C, 0x37, 0x40, 0x40, 0x45, 0x4A, 0x4A,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x37, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x37, 0x45, 0x45, 0x45, 0x37, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x40, 0x40, 0x48, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3C, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40,
+    0x4E, 0x4E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x4E, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x55, 0x45, 0x35, 0x55, 0x55,
+    0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55,
+    0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x45, 0x45, 0x56, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x48, 0x37, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x45, 0x55, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35,
+    0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x40, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x35, 0x57, 0x55,
+    0x55, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x55, 0x55, 0x40, 0x40, 0x55, 0x55, 0x45, 0x35, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x57, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x40, 0x35,
+    0x35, 0x35, 0x45, 0x45, 0x40, 0x40, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x35, 0x35, 0x50, 0x50, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x44, 0x4A, 0x35, 0x48, 0x45, 0x40,
+    0x40, 0x45, 0x45, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x40, 0x45, 0x40, 0x55, 0x55,
+    0x55, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x40, 0x40, 0x45, 0x45, 0x45, 0x40, 0x40,
+    0x40, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x45, 0x45, 0x35, 0x35, 0x35, 0x45, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x45, 0x45, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35,
+    0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x35, 0x55, 0x55,
+    0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x55, 0x40, 0x55, 0x55, 0x45, 0x40, 0x40,
+    0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x48, 0x4A, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x40, 0x45, 0x55, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x35, 0x57, 0x45,
+    0x55, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x55, 0x55, 0x40, 0x40, 0x55, 0x55, 0x45, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x57, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x40, 0x35,
+    0x44, 0x35, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x45, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35, 0x40, 0x35, 0x40, 0x35, 0x35,
+    0x40, 0x40, 0x40, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x57, 0x55,
+    0x45, 0x55, 0x55, 0x40, 0x40, 0x40, 0x55, 0x55, 0x55, 0x40, 0x55, 0x55, 0x55, 0x45, 0x40, 0x40,
+    0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x57, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4A, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x55, 0x55, 0x55, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x35, 0x45, 0x45,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x40, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x40, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5A, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x44,
+    0x35, 0x45, 0x55, 0x55, 0x5A, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x35, 0x55, 0x45,
+    0x55, 0x55, 0x57, 0x55, 0x55, 0x40, 0x45, 0x55, 0x55, 0x40, 0x55, 0x55, 0x45, 0x45, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x57, 0x57, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x40,
+    0x40, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x55, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x35, 0x57, 0x55,
+    0x55, 0x45, 0x45, 0x45, 0x45, 0x40, 0x55, 0x55, 0x55, 0x40, 0x55, 0x55, 0x55, 0x45, 0x5B, 0x44,
+    0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x35,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5C, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x40, 0x45, 0x55, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x45, 0x40, 0x40, 0x40, 0x40, 0x57,
+    0x55, 0x55, 0x45, 0x45, 0x45, 0x40, 0x45, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57,
+    0x40, 0x40, 0x55, 0x55, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x45, 0x5D, 0x5E, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x4A,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5F, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x48,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x5D, 0x5D, 0x40, 0x5D, 0x40, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x5D, 0x40, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x45, 0x5D, 0x5E, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x5D, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x5F, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x35, 0x60, 0x60, 0x60, 0x5A, 0x48, 0x5A, 0x5A, 0x61, 0x5A, 0x5A, 0x56, 0x61, 0x4C, 0x4C, 0x4C,
+    0x4C, 0x4C, 0x61, 0x44, 0x4C, 0x44, 0x44, 0x44, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x62, 0x45, 0x44, 0x45, 0x44, 0x45, 0x63, 0x64, 0x63, 0x64, 0x55, 0x55,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40,
+    0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x65,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x56, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x62, 0x62,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x44,
+    0x5A, 0x5A, 0x56, 0x5A, 0x48, 0x44, 0x44, 0x44, 0x44, 0x61, 0x61, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x66, 0x66, 0x45, 0x45, 0x45,
+    0x45, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x66, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x5D,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x55, 0x55, 0x45, 0x45, 0x5D, 0x5D, 0x5D, 0x5D, 0x45, 0x45,
+    0x45, 0x5D, 0x66, 0x66, 0x66, 0x5D, 0x5D, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5D, 0x5D,
+    0x5D, 0x45, 0x45, 0x45, 0x45, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x45, 0x66, 0x55, 0x45, 0x45, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x45, 0x5D, 0x66,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x66, 0x66, 0x66, 0x45, 0x44, 0x44,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x31, 0x40, 0x40, 0x40, 0x40, 0x40, 0x31, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x48, 0x37, 0x2E, 0x2E, 0x2E,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40,
+    0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40,
+    0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x45, 0x45,
+    0x48, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40,
+    0x4B, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x44, 0x48, 0x35,
+    0x6A, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x63, 0x64, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x56, 0x56, 0x56, 0x6B, 0x6B,
+    0x6B, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x45, 0x45, 0x45, 0x55, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35,
+    0x35, 0x35, 0x45, 0x45, 0x55, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35,
+    0x35, 0x40, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x45, 0x45, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x56, 0x56, 0x6C, 0x5F, 0x56, 0x48, 0x56, 0x4A, 0x5D, 0x45, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x48, 0x48, 0x4C, 0x4C, 0x56, 0x56, 0x6D, 0x48, 0x4C, 0x4C, 0x48, 0x45, 0x45, 0x45, 0x6E, 0x45,
+    0x35, 0x35, 0x35, 0x37, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40,
+    0x45, 0x45, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x55, 0x55, 0x55, 0x40, 0x40, 0x40, 0x40,
+    0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x40, 0x40, 0x40, 0x4C, 0x4C, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x58, 0x40, 0x40, 0x40, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x55, 0x55, 0x45, 0x40, 0x40, 0x48, 0x48,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x55, 0x45, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40,
+    0x45, 0x66, 0x45, 0x66, 0x66, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x45,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x5F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x45, 0x57, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x45, 0x55, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x56, 0x48, 0x56, 0x56, 0x56,
+    0x56, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x56, 0x56, 0x40,
+    0x45, 0x45, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x55, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x55, 0x45, 0x45, 0x45, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x55, 0x45, 0x45, 0x55, 0x55, 0x55, 0x45, 0x55, 0x45,
+    0x45, 0x45, 0x55, 0x55, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48, 0x48, 0x48, 0x48,
+    0x35, 0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x40, 0x40, 0x40, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x56, 0x56,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x40, 0x31, 0x31, 0x31,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x48, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x45, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x45, 0x35, 0x35, 0x55, 0x45, 0x45, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x31, 0x40, 0x31, 0x40, 0x31, 0x40, 0x31,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x36, 0x3C, 0x2E, 0x3C,
+    0x3C, 0x3C, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x36, 0x3C, 0x3C, 0x3C,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x40, 0x3C, 0x3C, 0x3C,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x3C, 0x3C, 0x3C,
+    0x40, 0x40, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x36, 0x6F, 0x3C, 0x40,
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x1E, 0x6A, 0x6A, 0x6A, 0x70, 0x71, 0x72, 0x51, 0x51,
+    0x73, 0x74, 0x4B, 0x73, 0x75, 0x76, 0x23, 0x48, 0x77, 0x78, 0x63, 0x27, 0x79, 0x7A, 0x63, 0x27,
+    0x23, 0x23, 0x23, 0x48, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x51, 0x51, 0x51, 0x51, 0x51, 0x80,
+    0x81, 0x4F, 0x81, 0x81, 0x4F, 0x81, 0x4F, 0x4F, 0x48, 0x27, 0x30, 0x23, 0x82, 0x6C, 0x23, 0x83,
+    0x83, 0x48, 0x48, 0x48, 0x84, 0x63, 0x64, 0x6C, 0x6C, 0x82, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x48, 0x43, 0x48, 0x83, 0x48, 0x56, 0x48, 0x56, 0x56, 0x56, 0x56, 0x48, 0x56, 0x56, 0x6A,
+    0x85, 0x86, 0x86, 0x86, 0x86, 0x87, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+    0x58, 0x37, 0x40, 0x40, 0x2C, 0x58, 0x58, 0x58, 0x58, 0x58, 0x43, 0x43, 0x43, 0x63, 0x64, 0x3A,
+    0x58, 0x2C, 0x2C, 0x2C, 0x2C, 0x58, 0x58, 0x58, 0x58, 0x58, 0x43, 0x43, 0x43, 0x63, 0x64, 0x40,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40, 0x40,
+    0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x50, 0x4A, 0x88, 0x4A, 0x4A, 0x21, 0x4A, 0x4A, 0x4A,
+    0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x50, 0x4A, 0x4A, 0x4A, 0x4A, 0x50, 0x4A, 0x4A, 0x50, 0x4A,
+    0x50, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46,
+    0x46, 0x45, 0x46, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x31, 0x2A, 0x44, 0x8A, 0x44, 0x31, 0x44, 0x2A, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x2E,
+    0x31, 0x31, 0x31, 0x34, 0x44, 0x31, 0x8B, 0x44, 0x43, 0x31, 0x31, 0x31, 0x31, 0x31, 0x44, 0x44,
+    0x44, 0x8A, 0x29, 0x44, 0x31, 0x44, 0x32, 0x44, 0x31, 0x44, 0x31, 0x32, 0x31, 0x31, 0x44, 0x2E,
+    0x31, 0x31, 0x31, 0x31, 0x2E, 0x35, 0x35, 0x35, 0x35, 0x8C, 0x44, 0x44, 0x2E, 0x2E, 0x31, 0x31,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x44, 0x43, 0x44, 0x44, 0x2E, 0x44,
+    0x58, 0x58, 0x58, 0x2C, 0x2C, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x2C, 0x2C, 0x2C, 0x2C, 0x58,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6B, 0x6B, 0x6B, 0x6B,
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+    0x6B, 0x6B, 0x6B, 0x31, 0x2E, 0x6B, 0x6B, 0x6B, 0x6B, 0x2C, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40,
+    0x33, 0x33, 0x33, 0x33, 0x8E, 0x29, 0x29, 0x29, 0x29, 0x29, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44,
+    0x43, 0x44, 0x44, 0x43, 0x44, 0x44, 0x43, 0x44, 0x44, 0x25, 0x25, 0x44, 0x44, 0x44, 0x43, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43,
+    0x44, 0x44, 0x33, 0x44, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x33, 0x43, 0x33, 0x33, 0x43, 0x43, 0x43, 0x33, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33,
+    0x43, 0x33, 0x8F, 0x8F, 0x43, 0x33, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x33, 0x33,
+    0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x33, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x33, 0x33, 0x33, 0x33, 0x43, 0x43, 0x43, 0x43, 0x33, 0x33, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x33, 0x33, 0x43, 0x43, 0x33, 0x33, 0x33, 0x33, 0x43, 0x43, 0x33, 0x33, 0x43, 0x43, 0x33, 0x33,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x33, 0x33, 0x43, 0x43, 0x33, 0x33, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x90,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x63, 0x64, 0x63, 0x64, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x91, 0x91, 0x44, 0x44, 0x44, 0x44,
+    0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x92, 0x93, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x94, 0x94, 0x94, 0x94, 0x25, 0x25, 0x25,
+    0x91, 0x95, 0x95, 0x91, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x8A, 0x8A, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x58, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x8A, 0x8A, 0x44, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x25, 0x25, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x8A, 0x8A, 0x44, 0x44, 0x29, 0x33, 0x44, 0x44, 0x44, 0x44, 0x8A, 0x8A, 0x44, 0x44,
+    0x29, 0x33, 0x44, 0x44, 0x44, 0x44, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x8A, 0x44, 0x44, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8A,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x43, 0x43, 0x98, 0x98, 0x99, 0x99, 0x43,
+    0x95, 0x95, 0x95, 0x95, 0x25, 0x29, 0x8A, 0x25, 0x25, 0x29, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29,
+    0x25, 0x25, 0x25, 0x44, 0x91, 0x91, 0x25, 0x25, 0x95, 0x25, 0x95, 0x95, 0x9A, 0x9B, 0x9A, 0x95,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x95, 0x95, 0x95, 0x25, 0x25, 0x25, 0x25,
+    0x29, 0x25, 0x29, 0x25, 0x25, 0x25, 0x25, 0x25, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x29, 0x29, 0x25, 0x29, 0x29, 0x29, 0x25, 0x29, 0x9A, 0x29, 0x29, 0x25, 0x29, 0x29, 0x25, 0x8E,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x91,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x25, 0x25, 0x25, 0x94, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29,
+    0x25, 0x94, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x94, 0x94, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x91, 0x91, 0x9A,
+    0x95, 0x95, 0x95, 0x95, 0x91, 0x91, 0x9A, 0x9A, 0x9A, 0x29, 0x29, 0x29, 0x29, 0x9A, 0x94, 0x9A,
+    0x9A, 0x9A, 0x29, 0x9A, 0x91, 0x29, 0x29, 0x29, 0x9A, 0x9A, 0x29, 0x29, 0x9A, 0x29, 0x29, 0x9A,
+    0x9A, 0x9A, 0x25, 0x29, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29, 0x91, 0x29, 0x29, 0x29, 0x29, 0x29,
+    0x29, 0x9A, 0x91, 0x91, 0x9A, 0x91, 0x29, 0x9A, 0x9A, 0x9C, 0x91, 0x29, 0x29, 0x91, 0x9A, 0x9A,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x44, 0x44, 0x95, 0x95, 0x9D, 0x9D, 0x9B, 0x9B, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x44, 0x25, 0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x44, 0x44,
+    0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x94, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x25, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8A, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x25, 0x44, 0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x94, 0x44, 0x94, 0x44,
+    0x44, 0x44, 0x44, 0x94, 0x94, 0x94, 0x44, 0x94, 0x44, 0x44, 0x44, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x44, 0x9F, 0xA0, 0x95, 0x25, 0x25, 0x25, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64,
+    0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x44, 0x94, 0x94, 0x94, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x94, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x94,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x63, 0x64, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x0C, 0x1C, 0x0C, 0x1C, 0x0C, 0x1C, 0x0C, 0x1C, 0x63, 0x64,
+    0x43, 0x43, 0x43, 0x43, 0x98, 0x98, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x63, 0x64, 0x0C, 0x1C, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63,
+    0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x63, 0x64, 0x63, 0x64, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x63, 0x64, 0x43, 0x43,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x94, 0x94, 0x44, 0x44, 0x44,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44,
+    0x94, 0x44, 0x44, 0x44, 0x44, 0x94, 0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x31, 0x2E, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x31,
+    0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x37, 0x31, 0x31,
+    0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x31, 0x2E, 0x31, 0x2E, 0x45,
+    0x45, 0x45, 0x31, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4C, 0x56, 0x56, 0x56, 0x58, 0x4C, 0x56,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x2E, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37,
+    0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40,
+    0xA1, 0xA1, 0x27, 0x30, 0x27, 0x30, 0xA1, 0xA1, 0xA1, 0x27, 0x30, 0xA1, 0x27, 0x30, 0x56, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x48, 0x4B, 0xA2, 0x56, 0xA3, 0x48, 0x27, 0x30, 0x48, 0x48,
+    0x27, 0x30, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x56, 0x56, 0x56, 0x56, 0x4C, 0x37,
+    0x56, 0x56, 0x48, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0xA4, 0xA4, 0x56, 0x56, 0x56, 0x48,
+    0x4B, 0x56, 0x63, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x48, 0x56, 0x48, 0x56, 0x56,
+    0x44, 0x44, 0x48, 0x4C, 0x4C, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x4B, 0x40, 0x40,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x40, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x40, 0x40, 0x40, 0x40,
+    0xA6, 0xA7, 0xA7, 0xA8, 0xA5, 0xA9, 0xAA, 0xAB, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93,
+    0x92, 0x93, 0xA5, 0xA5, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0xAC, 0x92, 0x93, 0x93,
+    0xA5, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE,
+    0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB1, 0xA5, 0xA5, 0xAB, 0xAB, 0xAB, 0xA9, 0xB2, 0xB3, 0xA5, 0xB4,
+    0x40, 0xB5, 0xAA, 0xB5, 0xAA, 0xB5, 0xAA, 0xB5, 0xAA, 0xB5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xB5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xB5, 0xAA, 0xB5, 0xAA, 0xB5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xB5, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xB5, 0xB5, 0x40, 0x40, 0xAD, 0xAD, 0xB6, 0xB6, 0xB7, 0xB7, 0xAA,
+    0xB8, 0xB9, 0xBA, 0xB9, 0xBA, 0xB9, 0xBA, 0xB9, 0xBA, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xB9, 0xBA, 0xB9, 0xBA, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xBC, 0xBC, 0xBC, 0xBA,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+    0x40, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x40,
+    0xA5, 0xA5, 0xBE, 0xBE, 0xBE, 0xBE, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x40,
+    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0xA5, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x91, 0xA5, 0x91, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA5,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xA9, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x40, 0x40, 0x40,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x56, 0x4C, 0x56,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x35, 0x45,
+    0x46, 0x46, 0x46, 0x48, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x48, 0x37,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x37, 0x37, 0x45, 0x45,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+    0x45, 0x45, 0x48, 0x56, 0x56, 0x56, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x38, 0x38, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x37, 0x38, 0x38, 0x31, 0x2E, 0x31, 0x2E, 0x35,
+    0x31, 0x2E, 0x31, 0x2E, 0x2E, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E,
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x2E, 0x40, 0x2E, 0x40, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x37, 0x37, 0x37, 0x31, 0x2E, 0x35, 0x37, 0x37, 0x2E, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x45, 0x35, 0x35, 0x35, 0x45, 0x35, 0x35, 0x35, 0x35, 0x45, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x55, 0x55, 0x45, 0x45, 0x55, 0x44, 0x44, 0x44, 0x44, 0x45, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x44, 0x44, 0x50, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x5A, 0x5A, 0x4C, 0x4C, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x55, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x56, 0x56,
+    0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x48, 0x48, 0x48, 0x35, 0x5A, 0x35, 0x35, 0x45,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x56, 0x56,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x55, 0x55, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48,
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x45, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x55, 0x55,
+    0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x56, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x40, 0x37,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0x48, 0x48,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x45, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55,
+    0x55, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x55, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x48, 0x56, 0x56, 0x56,
+    0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x44, 0x44, 0x44, 0x5D, 0x66, 0x45, 0x66, 0x5D, 0x5D,
+    0x45, 0x5D, 0x45, 0x45, 0x45, 0x5D, 0x5D, 0x45, 0x45, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x45, 0x45,
+    0x5D, 0x45, 0x5D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5D, 0x5D, 0x5F, 0x48, 0x48,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x55, 0x45, 0x45, 0x55, 0x55,
+    0x56, 0x56, 0x35, 0x37, 0x37, 0x55, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40,
+    0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x38, 0x37, 0x37, 0x37, 0x37,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x3C, 0x3C, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x55, 0x55, 0x45, 0x55, 0x55, 0x45, 0x55, 0x55, 0x56, 0x55, 0x45, 0x40, 0x40,
+    0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x40, 0x40, 0x40, 0x40, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x40, 0x40, 0x40, 0x40,
+    0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC4, 0xC4,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4D, 0x45, 0x4D,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x43, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x40, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x40, 0x4D, 0x40,
+    0x4D, 0x4D, 0x40, 0x4D, 0x4D, 0x40, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x35, 0x35, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x64, 0x63,
+    0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x50, 0x44, 0x44, 0x44,
+    0xC5, 0xA7, 0xA7, 0xC6, 0xC5, 0xC7, 0xC7, 0x92, 0x93, 0xC8, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xA8, 0xC9, 0xC9, 0xCA, 0xCA, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92,
+    0x93, 0x92, 0x93, 0x92, 0x93, 0xA8, 0xA8, 0x92, 0x93, 0xA8, 0xA8, 0xA8, 0xA8, 0xCA, 0xCA, 0xCA,
+    0xCB, 0xA8, 0xCC, 0x40, 0xCD, 0xCE, 0xC7, 0xC7, 0xC9, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0xA8,
+    0xA8, 0xA8, 0xCF, 0xC9, 0xCF, 0xCF, 0xCF, 0x40, 0xA8, 0xD0, 0xD1, 0xA8, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x85,
+    0x40, 0xD2, 0xD3, 0xD3, 0xD4, 0xD5, 0xD3, 0xD6, 0xD7, 0xD8, 0xD3, 0xD9, 0xDA, 0xDB, 0xDC, 0xD3,
+    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 0xDF, 0xD9, 0xD9, 0xD9, 0xD2,
+    0xD3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xD7, 0xD3, 0xD8, 0xE1, 0xE2,
+    0xE1, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xD7, 0xD9, 0xD8, 0xD9, 0xD7,
+    0xD8, 0xE4, 0xE5, 0xE6, 0xE4, 0xE7, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+    0xEA, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+    0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xEB, 0xEB,
+    0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+    0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x40,
+    0x40, 0x40, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x40, 0x40, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+    0x40, 0x40, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x40, 0x40, 0xEC, 0xEC, 0xEC, 0x40, 0x40, 0x40,
+    0xED, 0xD4, 0xD9, 0xE1, 0xEE, 0xD4, 0xD4, 0x40, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0x40,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x51, 0x51, 0x51, 0xF1, 0x8A, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40,
+    0x56, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+    0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x58, 0x58, 0x58, 0x58, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x58, 0x58, 0x44, 0x44, 0x44, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40,
+    0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x40, 0x40,
+    0x45, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35,
+    0x35, 0x6B, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x6B, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x56,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x56, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x31, 0x31, 0x31, 0x31, 0x40, 0x40, 0x40, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x40, 0x31, 0x31, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x40, 0x40, 0x40,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x40, 0x40, 0x35, 0x40, 0x40, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x44, 0x44, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x56,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x35, 0x35,
+    0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x45, 0x45,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x45,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x58, 0x58, 0x48,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x44, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xF2, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x31, 0x31, 0x31, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x45, 0x45, 0x4B, 0x40, 0x40,
+    0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x58, 0x58, 0x58, 0x58, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40,
+    0x55, 0x45, 0x55, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x45, 0x35, 0x35, 0x45, 0x45, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45,
+    0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x48, 0x48, 0x4E, 0x56, 0x56,
+    0x56, 0x56, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4E, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x56, 0x56, 0x56, 0x56, 0x35, 0x55, 0x55, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x45, 0x48, 0x5A, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55,
+    0x55, 0x35, 0x5B, 0x5B, 0x35, 0x56, 0x56, 0x48, 0x56, 0x45, 0x45, 0x45, 0x45, 0x48, 0x55, 0x45,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x35, 0x5A, 0x35, 0x56, 0x56, 0x56,
+    0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x45,
+    0x45, 0x45, 0x55, 0x55, 0x45, 0x55, 0x45, 0x45, 0x56, 0x56, 0x48, 0x56, 0x56, 0x48, 0x45, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45,
+    0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x55, 0x55, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35,
+    0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x45, 0x45, 0x35, 0x57, 0x55,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x40, 0x40, 0x55, 0x55, 0x40, 0x40, 0x55, 0x55, 0x55, 0x40, 0x40,
+    0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x57, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x55, 0x55, 0x40, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x55, 0x55, 0x45, 0x45, 0x45, 0x55, 0x45, 0x35, 0x35, 0x35, 0x35, 0x56, 0x56, 0x56, 0x56, 0x48,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x56, 0x40, 0x48, 0x45, 0x35,
+    0x57, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x55, 0x55, 0x57, 0x55, 0x45,
+    0x45, 0x55, 0x45, 0x45, 0x35, 0x35, 0x48, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x57,
+    0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x55, 0x55, 0x55, 0x55, 0x45, 0x45, 0x55, 0x45,
+    0x45, 0x5A, 0x56, 0x56, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x40, 0x40,
+    0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x55, 0x45,
+    0x45, 0x56, 0x56, 0x48, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x55, 0x45, 0x55, 0x55,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x35, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40, 0x45, 0x45, 0x45,
+    0x66, 0x66, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x58, 0x58, 0x56, 0x56, 0x56, 0x44,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x45, 0x48, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x55, 0x55, 0x40, 0x40, 0x45, 0x45, 0x55, 0x45, 0x5B,
+    0x55, 0x5B, 0x55, 0x45, 0x56, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x55, 0x55, 0x55, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x45, 0x45, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x35, 0x5A, 0x35, 0x55, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x5B, 0x45, 0x45, 0x45, 0x45, 0x5A,
+    0x48, 0x56, 0x56, 0x56, 0x56, 0x5A, 0x48, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45, 0x45, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45, 0x45, 0x56, 0x56, 0x56, 0x35, 0x5A, 0x5A,
+    0x5A, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x55,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x55, 0x45,
+    0x35, 0x56, 0x56, 0x56, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x5A, 0x4C, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x40, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x55, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x55, 0x45, 0x45, 0x55, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x45, 0x40, 0x45, 0x45, 0x40, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x5B, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40,
+    0x45, 0x45, 0x40, 0x55, 0x55, 0x45, 0x55, 0x45, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x45, 0x45, 0x55, 0x55, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x50, 0x50, 0x50,
+    0x50, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x56,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x40,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF4, 0x35, 0x35,
+    0x35, 0x35, 0xF4, 0x35, 0x35, 0x35, 0xF3, 0xF4, 0xF3, 0xF4, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xF3, 0xF4, 0xF4, 0x35, 0x35, 0x35, 0x35,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0xF5, 0xF6, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xF3, 0xF4,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0x56, 0x56,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x56, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x56, 0x56, 0x56, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44,
+    0x37, 0x37, 0x37, 0x37, 0x56, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x56, 0x56, 0x48, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40, 0x45,
+    0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45,
+    0x45, 0x45, 0x45, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0xA9, 0xA9, 0xBB, 0xA9, 0xF7, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xF8, 0xF8, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xFA, 0xFA, 0xFA, 0xFA, 0x40, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x40, 0xFA, 0xFA, 0x40,
+    0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xBA, 0xBA, 0xBA, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xB5, 0xB5, 0xB5, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xB9, 0xB9, 0xB9, 0xB9, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x40, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x44, 0x45, 0x45, 0x56,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x57, 0x55, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x55, 0x57, 0x57,
+    0x57, 0x57, 0x57, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44,
+    0x44, 0x44, 0x45, 0x45, 0x45, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x40, 0x31, 0x31,
+    0x40, 0x40, 0x31, 0x40, 0x40, 0x31, 0x31, 0x40, 0x40, 0x31, 0x31, 0x31, 0x31, 0x40, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x40, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x40, 0x31, 0x31, 0x31, 0x31, 0x40, 0x40, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x40, 0x31, 0x31, 0x31, 0x31, 0x40,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x40, 0x31, 0x40, 0x40, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x40, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x43, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x43, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x43,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x43,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x43, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x31, 0x2E, 0x40, 0x40, 0x52, 0x52,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x56, 0x56, 0x56, 0x56, 0x48, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x35, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x40, 0x45, 0x45, 0x40, 0x45, 0x45, 0x45, 0x45, 0x45, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0x35, 0x44,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x45, 0x45, 0x45,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4A,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x37, 0x40, 0x40, 0x40, 0x40,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40, 0x40, 0x40, 0x40, 0xA2, 0xA2,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5C, 0x58, 0x58, 0x58,
+    0x50, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x44, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x40, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x40, 0x35, 0x35, 0x40, 0x35, 0x40, 0x40, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40, 0x35, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x35, 0x40, 0x40, 0x40, 0x40, 0x35, 0x40, 0x35, 0x40, 0x35, 0x40, 0x35, 0x35, 0x35,
+    0x40, 0x35, 0x35, 0x40, 0x35, 0x40, 0x40, 0x35, 0x40, 0x35, 0x40, 0x35, 0x40, 0x35, 0x40, 0x35,
+    0x40, 0x35, 0x35, 0x40, 0x35, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x40,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35, 0x40, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x43, 0x43, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x95, 0x95, 0x95, 0x95, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x95, 0x95, 0x95, 0x95, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xFB,
+    0xFB, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0xFB, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x91,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x58, 0x58, 0x95, 0x95, 0x95,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x44, 0x25,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x44, 0x44, 0x25, 0x95, 0x95, 0x95,
+    0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x8A, 0x8A, 0x8A, 0x8A, 0x94, 0x8A,
+    0x8A, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x95, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xA5, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x91, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x91,
+    0xA5, 0xA5, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA5, 0xFB, 0xFB, 0xFB, 0xFB,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x25, 0x25, 0x95, 0x95,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x9D, 0x9B, 0x9B, 0x95, 0x95, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x91, 0x95, 0x95, 0x95, 0x91, 0x95, 0x95, 0x95, 0x91, 0x91, 0x91, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95,
+    0x91, 0x95, 0x9D, 0x9D, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91,
+    0x91, 0x9D, 0x9D, 0x9D, 0x91, 0x9D, 0x9D, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D,
+    0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x94, 0x91, 0x94, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x94,
+    0x91, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95, 0x95, 0x91,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x25, 0x95, 0x91, 0x91, 0x91, 0x91, 0x95,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x9B, 0x9B, 0x95, 0x95, 0x95, 0x95, 0x9D, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x9B, 0x95, 0x95, 0x95, 0x95, 0x9D, 0x9D, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x95, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x9E, 0x9E, 0x9E, 0xFE, 0xFE, 0xFE, 0x44, 0x44, 0x44, 0x44,
+    0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9D, 0x95, 0x95, 0x95,
+    0x91, 0x91, 0x91, 0x95, 0x95, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x91, 0x91, 0x91,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x91, 0x91, 0xFB, 0xFB, 0xFB,
+    0x95, 0x95, 0x95, 0x95, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x95, 0x95, 0x95, 0x95, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFB, 0xFB,
+    0x95, 0x95, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x9D, 0x91, 0x91, 0x9D,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x91, 0xB4, 0x9D, 0x9D, 0x9D, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xB4, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x91, 0x9D, 0x9D, 0x91, 0x9D, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D,
+    0x91, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x91, 0x91,
+    0x25, 0x25, 0x25, 0x25, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x9D, 0x9D, 0x9D, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x44, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x40, 0x40,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xAA, 0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x40, 0x40,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0x87, 0x51, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x40, 0x40,
+};
+
+namespace RichED { namespace impl {
+    // lookup without branch
+    constexpr CharProperty prop_lookup(char32_t ch) noexcept {
+        return { RED_PROP_RECORD[RED_PROP_STAGE3[
+            RED_PROP_STAGE2[RED_PROP_STAGE1[ch >> 9] << 5 | ((ch >> 4) & 31)] << 4 | (ch & 15)
+        ]] };
+    }
+    // spot checks at compile time
+    static_assert(prop_lookup(U'a').LineBreak() == LB_AL, "bad table");
+    static_assert(prop_lookup(U'a').WordBreak() == WB_ALetter, "bad table");
+    static_assert(prop_lookup(U'a').Category() == GC_Ll, "bad table");
+    static_assert(prop_lookup(U'a').Width() == EAW_Na, "bad table");
+    static_assert(prop_lookup(0x0D).GraphemeBreak() == GB_CR, "bad table");
+    static_assert(prop_lookup(0x300).GraphemeBreak() == GB_Extend, "bad table");
+    static_assert(prop_lookup(0x3000).Width() == EAW_F, "bad table");
+    static_assert(prop_lookup(0x4E00).LineBreak() == LB_ID, "bad table");
+    static_assert(prop_lookup(0xAC00).LineBreak() == LB_H2, "bad table");
+    static_assert(prop_lookup(0xAC01).GraphemeBreak() == GB_LVT, "bad table");
+    static_assert(prop_lookup(0x1F600).Pictographic(), "bad table");
+    static_assert(prop_lookup(0x1F1E6).GraphemeBreak() == GB_RI, "bad table");
+    static_assert(prop_lookup(0xE0001).Category() == GC_Cf, "bad table");
+    static_assert(prop_lookup(0x10FFFF).Category() == GC_Cn, "bad table");
+}}
+
+
+/// <summary>
+/// Gets the unicode properties of char.
+/// </summary>
+/// <param name="ch">The char.</param>
+/// <returns></returns>
+auto RichED::GetCharProperty(char32_t ch) noexcept -> CharProperty {
+    assert(ch < 0x110000);
+    return impl::prop_lookup(ch);
+}
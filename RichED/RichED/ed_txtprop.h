@@ -0,0 +1,94 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+
+// tables in ed_txtprop.cpp are generated by tools/ucd_dump.pl (UCD of perl 5.36, Unicode 14.0.0)
+// and tools/ucd_tables.py, enum value order here must match the lists there
+
+// RichED namespace
+namespace RichED {
+    // line break class [UAX #14], AI/SG/XX/SA/CJ resolved by lookup [LB1]
+    enum LineBreakClass : uint8_t {
+        // classes in pair table
+        LB_OP = 0, LB_CL, LB_CP, LB_QU, LB_GL, LB_NS, LB_EX, LB_SY,
+        LB_IS, LB_PR, LB_PO, LB_NU, LB_AL, LB_HL, LB_ID, LB_IN,
+        LB_HY, LB_BA, LB_BB, LB_B2, LB_ZW, LB_CM, LB_WJ, LB_H2,
+        LB_H3, LB_JL, LB_JV, LB_JT, LB_RI, LB_EB, LB_EM, LB_ZWJ,
+        LB_CB,
+        // classes resolved before pair table
+        LB_BK, LB_CR, LB_LF, LB_NL, LB_SP,
+        // count of class
+        LB_COUNT
+    };
+    // east asian width [UAX #11]
+    enum EastAsianWidth : uint8_t {
+        EAW_N = 0, EAW_A, EAW_H, EAW_W, EAW_F, EAW_Na
+    };
+    // general category
+    enum GeneralCategory : uint8_t {
+        GC_Lu = 0, GC_Ll, GC_Lt, GC_Lm, GC_Lo, GC_Mn, GC_Mc, GC_Me,
+        GC_Nd, GC_Nl, GC_No, GC_Pc, GC_Pd, GC_Ps, GC_Pe, GC_Pi,
+        GC_Pf, GC_Po, GC_Sm, GC_Sc, GC_Sk, GC_So, GC_Zs, GC_Zl,
+        GC_Zp, GC_Cc, GC_Cf, GC_Cs, GC_Co, GC_Cn
+    };
+    // grapheme cluster break property [UAX #29]
+    enum GraphemeBreakProperty : uint8_t {
+        GB_Other = 0, GB_CR, GB_LF, GB_Control, GB_Extend, GB_ZWJ, GB_RI,
+        GB_Prepend, GB_SpacingMark, GB_L, GB_V, GB_T, GB_LV, GB_LVT,
+        // count of property
+        GB_COUNT
+    };
+    // word break property [UAX #29]
+    enum WordBreakProperty : uint8_t {
+        WB_Other = 0, WB_CR, WB_LF, WB_Newline, WB_Extend, WB_ZWJ, WB_RI,
+        WB_Format, WB_Katakana, WB_HebrewLetter, WB_ALetter, WB_SingleQuote,
+        WB_DoubleQuote, WB_MidNumLet, WB_MidLetter, WB_MidNum, WB_Numeric,
+        WB_ExtendNumLet, WB_WSegSpace,
+        // count of property
+        WB_COUNT
+    };
+    // unicode properties of char packed in 32 bits
+    struct CharProperty {
+        // [0, 6): line break, [6, 10): grapheme break, [10]: extended pictographic,
+        // [11, 16): word break, [16, 21): general category, [21, 24): east asian width
+        uint32_t        data;
+        // line break class, resolved [LB1]
+        constexpr LineBreakClass LineBreak() const noexcept { return static_cast<LineBreakClass>(data & 0x3f); }
+        // grapheme cluster break property
+        constexpr GraphemeBreakProperty GraphemeBreak() const noexcept { return static_cast<GraphemeBreakProperty>((data >> 6) & 0xf); }
+        // extended pictographic
+        constexpr bool Pictographic() const noexcept { return !!(data & (1 << 10)); }
+        // word break property
+        constexpr WordBreakProperty WordBreak() const noexcept { return static_cast<WordBreakProperty>((data >> 11) & 0x1f); }
+        // general category
+        constexpr GeneralCategory Category() const noexcept { return static_cast<GeneralCategory>((data >> 16) & 0x1f); }
+        // east asian width
+        constexpr EastAsianWidth Width() const noexcept { return static_cast<EastAsianWidth>((data >> 21) & 0x7); }
+    };
+    // get unicode properties of char, ch <= 0x10FFFF
+    auto GetCharProperty(char32_t ch) noexcept->CharProperty;
+}
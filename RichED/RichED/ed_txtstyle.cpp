@@ -0,0 +1,136 @@
+﻿#include "ed_txtdoc.h"
+#include "ed_txtstyle.h"
+#include <cstring>
+#include <utility>
+
+// RichED::impl
+namespace RichED { namespace impl {
+    // hash riched-data, fnv-1a
+    inline uint32_t style_hash(const RichData& rd) noexcept {
+        const auto ptr = reinterpret_cast<const uint8_t*>(&rd);
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i != sizeof(rd); ++i) {
+            hash ^= ptr[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+    // same riched-data?
+    inline bool style_same(const RichData& a, const RichData& b) noexcept {
+        return !std::memcmp(&a, &b, sizeof(a));
+    }
+}}
+
+/// <summary>
+/// Releases all styles.
+/// </summary>
+/// <returns></returns>
+void RichED::CEDStyleTable::ReleaseAll() noexcept {
+    const uint32_t page_count = m_capacity / TEXT_STYLE_PAGE_LEN;
+    for (uint32_t i = 0; i != page_count; ++i) RichED::Free(m_ppPage[i]);
+    RichED::Free(m_ppPage);
+    m_ppPage = nullptr;
+    m_pSlot = nullptr;
+    m_count = 0;
+    m_capacity = 0;
+}
+
+/// <summary>
+/// Swaps with the specified table.
+/// </summary>
+/// <param name="other">The other.</param>
+/// <returns></returns>
+void RichED::CEDStyleTable::Swap(CEDStyleTable& other) noexcept {
+    std::swap(m_ppPage, other.m_ppPage);
+    std::swap(m_pSlot, other.m_pSlot);
+    std::swap(m_count, other.m_count);
+    std::swap(m_capacity, other.m_capacity);
+}
+
+/// <summary>
+/// Gets the byte size.
+/// </summary>
+/// <returns></returns>
+auto RichED::CEDStyleTable::GetByteSize() const noexcept -> size_t {
+    const size_t page_count = m_capacity / TEXT_STYLE_PAGE_LEN;
+    const size_t page_used = (m_count + TEXT_STYLE_PAGE_LEN - 1) / TEXT_STYLE_PAGE_LEN;
+    return page_count * sizeof(RichData*) + size_t(m_capacity) * sizeof(uint16_t) * 2
+        + page_used * sizeof(RichData) * TEXT_STYLE_PAGE_LEN;
+}
+
+PCN_NOINLINE
+/// <summary>
+/// Rebuilds table with new capacity.
+/// </summary>
+/// <param name="capacity">The capacity.</param>
+/// <param name="doc">The document.</param>
+/// <returns></returns>
+bool RichED::CEDStyleTable::rebuild(uint32_t capacity, CEDTextDocument& doc) noexcept {
+    static_assert(TEXT_STYLE_INIT_COUNT % TEXT_STYLE_PAGE_LEN == 0, "page aligned");
+    // 槽数量为容量两倍(2的幂), 保证装载率不超过50%
+    // 数据页本身不移动, 只有页表与槽随容量重建
+    const size_t page_count = capacity / TEXT_STYLE_PAGE_LEN;
+    const size_t page_len = sizeof(RichData*) * page_count;
+    const size_t slot_len = sizeof(uint16_t) * capacity * 2;
+    const auto ptr = static_cast<char*>(doc.Alloc(page_len + slot_len));
+    if (!ptr) return false;
+    const auto page = reinterpret_cast<RichData**>(ptr);
+    const auto slot = reinterpret_cast<uint16_t*>(ptr + page_len);
+    const size_t page_old = m_capacity / TEXT_STYLE_PAGE_LEN;
+    std::memset(ptr, 0, page_len + slot_len);
+    if (page_old) std::memcpy(page, m_ppPage, sizeof(RichData*) * page_old);
+    RichED::Free(m_ppPage);
+    m_ppPage = page;
+    m_pSlot = slot;
+    m_capacity = capacity;
+    // 重新散列
+    const uint32_t mask = capacity * 2 - 1;
+    for (uint32_t i = 0; i != m_count; ++i) {
+        uint32_t index = impl::style_hash(this->Get(static_cast<uint16_t>(i))) & mask;
+        while (slot[index]) index = (index + 1) & mask;
+        slot[index] = static_cast<uint16_t>(i + 1);
+    }
+    return true;
+}
+
+/// <summary>
+/// Interns the specified riched-data.
+/// </summary>
+/// <param name="rd">The riched-data.</param>
+/// <param name="doc">The document.</param>
+/// <returns>style id, TEXT_STYLE_INVALID if failed</returns>
+auto RichED::CEDStyleTable::Intern(const RichData& rd, CEDTextDocument& doc) noexcept -> uint16_t {
+    const auto hash = impl::style_hash(rd);
+    // 查找已有的
+    if (m_capacity) {
+        const uint32_t mask = m_capacity * 2 - 1;
+        uint32_t index = hash & mask;
+        while (const uint32_t id1 = m_pSlot[index]) {
+            const auto id = static_cast<uint16_t>(id1 - 1);
+            if (impl::style_same(this->Get(id), rd)) return id;
+            index = (index + 1) & mask;
+        }
+    }
+    // 已满
+    if (m_count >= TEXT_STYLE_INVALID) return TEXT_STYLE_INVALID;
+    // 扩容
+    if (m_count == m_capacity) {
+        const uint32_t capacity = m_capacity ? m_capacity * 2 : uint32_t(TEXT_STYLE_INIT_COUNT);
+        if (!this->rebuild(capacity, doc)) return TEXT_STYLE_INVALID;
+    }
+    // 新的一页
+    const uint32_t id = m_count;
+    auto& page = m_ppPage[id / TEXT_STYLE_PAGE_LEN];
+    if (!page) {
+        page = static_cast<RichData*>(doc.Alloc(sizeof(RichData) * TEXT_STYLE_PAGE_LEN));
+        if (!page) return TEXT_STYLE_INVALID;
+    }
+    // 添加
+    ++m_count;
+    page[id % TEXT_STYLE_PAGE_LEN] = rd;
+    const uint32_t mask = m_capacity * 2 - 1;
+    uint32_t index = hash & mask;
+    while (m_pSlot[index]) index = (index + 1) & mask;
+    m_pSlot[index] = static_cast<uint16_t>(id + 1);
+    return static_cast<uint16_t>(id);
+}
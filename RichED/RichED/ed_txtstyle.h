@@ -0,0 +1,74 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cassert>
+#include "ed_common.h"
+
+// RichED namespace
+namespace RichED {
+    // text document
+    class CEDTextDocument;
+    // style table: interned riched-data, cells hold 16-bit style id only
+    // riched-data stored in fixed pages, refs stay valid until Compact/ReleaseAll
+    class CEDStyleTable {
+    public:
+        // ctor
+        CEDStyleTable() noexcept {}
+        // dtor
+        ~CEDStyleTable() noexcept { this->ReleaseAll(); }
+        // no copy ctor
+        CEDStyleTable(const CEDStyleTable&) noexcept = delete;
+        // get riched-data of style id
+        auto&Get(uint16_t id) const noexcept { assert(id < m_count);
+            return m_ppPage[id / TEXT_STYLE_PAGE_LEN][id % TEXT_STYLE_PAGE_LEN]; }
+        // get style count
+        auto GetCount() const noexcept { return m_count; }
+        // get bytes of table
+        auto GetByteSize() const noexcept->size_t;
+        // find or add style, return TEXT_STYLE_INVALID if oom or full
+        auto Intern(const RichData&, CEDTextDocument&) noexcept->uint16_t;
+        // swap with other table
+        void Swap(CEDStyleTable&) noexcept;
+        // release all styles, ids will be invalid
+        void ReleaseAll() noexcept;
+        // same font? color/effect only used in rendering
+        static bool SameFont(const RichData& a, const RichData& b) noexcept {
+            return a.size == b.size && a.name == b.name && a.fflags == b.fflags; }
+    private:
+        // rebuild with new capacity
+        bool rebuild(uint32_t capacity, CEDTextDocument&) noexcept;
+    private:
+        // page table, [capacity / page] page + [capacity * 2] slots in one block
+        RichData**          m_ppPage = nullptr;
+        // hash slots, style id + 1, 0 for empty
+        uint16_t*           m_pSlot = nullptr;
+        // style count
+        uint32_t            m_count = 0;
+        // style capacity
+        uint32_t            m_capacity = 0;
+    };
+}
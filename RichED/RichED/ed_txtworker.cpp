@@ -0,0 +1,123 @@
+﻿#include "ed_config.h"
+#include "ed_txtworker.h"
+#include <cassert>
+#include <algorithm>
+
+
+/// <summary>
+/// Finalizes an instance of the <see cref="CEDLayoutWorker"/> class.
+/// </summary>
+/// <returns></returns>
+RichED::CEDLayoutWorker::~CEDLayoutWorker() noexcept {
+    this->Pause();
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_bExit = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+}
+
+/// <summary>
+/// Resumes running the step function.
+/// </summary>
+/// <param name="step">The step function.</param>
+/// <param name="ctx">The context.</param>
+/// <returns>false if worker thread not created</returns>
+bool RichED::CEDLayoutWorker::Resume(StepFunc step, void* ctx) noexcept {
+    assert(step && "bad step");
+    if (m_bRunning) return true;
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_fnStep = step;
+        m_pContext = ctx;
+        m_cStep = 0;
+        m_bWorking = true;
+        m_bPause.store(false, std::memory_order_relaxed);
+    }
+    // 第一次才创建线程, 之后线程一直等待
+    if (m_thread.joinable()) m_cv.notify_all();
+    else if (!this->create()) {
+        // 线程创建失败: 调用方改为在本线程布局
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_bWorking = false;
+        return false;
+    }
+    m_bRunning = true;
+    return true;
+}
+
+/// <summary>
+/// Creates the worker thread.
+/// </summary>
+/// <returns>false if failed</returns>
+bool RichED::CEDLayoutWorker::create() noexcept {
+    // std::thread 构造失败时抛出 std::system_error, 不能穿过noexcept
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+    try { m_thread = std::thread{ [this]() noexcept { this->run(); } }; }
+    catch (...) { return false; }
+#else
+    m_thread = std::thread{ [this]() noexcept { this->run(); } };
+#endif
+    return m_thread.joinable();
+}
+
+/// <summary>
+/// Pauses and waits for current step.
+/// </summary>
+/// <returns>step count since resume</returns>
+auto RichED::CEDLayoutWorker::Pause() noexcept -> uint32_t {
+    if (!m_bRunning) return 0;
+    m_bRunning = false;
+    m_bPause.store(true, std::memory_order_relaxed);
+    // 等待当前步骤完成: 互斥量保证步骤中的修改对调用方可见
+    std::unique_lock<std::mutex> lock{ m_mutex };
+    m_cv.wait(lock, [this]() noexcept { return !m_bWorking; });
+    return m_cStep;
+}
+
+/// <summary>
+/// Thread entry.
+/// </summary>
+/// <returns></returns>
+void RichED::CEDLayoutWorker::run() noexcept {
+    std::unique_lock<std::mutex> lock{ m_mutex };
+    while (true) {
+        m_cv.wait(lock, [this]() noexcept { return m_bExit || m_bWorking; });
+        if (m_bExit) break;
+        const auto step = m_fnStep;
+        const auto ctx = m_pContext;
+        uint32_t count = 0;
+        lock.unlock();
+        // 步骤之间检查暂停请求
+        while (!m_bPause.load(std::memory_order_relaxed)) {
+            ++count;
+            if (!step(ctx)) break;
+        }
+        lock.lock();
+        m_cStep = count;
+        m_bWorking = false;
+        m_cv.notify_all();
+    }
+}
+
+/// <summary>
+/// Runs the step function on pool threads.
+/// </summary>
+/// <param name="step">The step function.</param>
+/// <param name="ctx">The context.</param>
+/// <param name="count">The thread count, caller included.</param>
+/// <returns>thread count actually used</returns>
+auto RichED::CEDLayoutPool::Run(StepFunc step, void* ctx, uint32_t count) noexcept -> uint32_t {
+    count = std::min(count, uint32_t(LAYOUT_PARALLEL_THREAD));
+    uint32_t used = 0;
+    // 线程创建失败时以已有线程继续
+    while (used + 1 < count && m_workers[used].Resume(step, ctx)) ++used;
+    // 本线程同样参与
+    while (step(ctx));
+    // 所有任务已被领取, 暂停即等待完成
+    for (uint32_t i = 0; i != used; ++i) m_workers[i].Pause();
+    return used + 1;
+}
@@ -0,0 +1,97 @@
+﻿#pragma once
+/**
+* Copyright (c) 2018-2019 dustpg   mailto:dustpg@gmail.com
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ed_config.h"
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// RichED namespace
+namespace RichED {
+    // background worker: runs step function on a worker thread
+    // until finished or paused, owner must not touch shared data while running.
+    // idle-time task: no snapshot is taken, steps work on owner data in place,
+    // so owner has to pause it before any access, pause waits for one step only
+    class CEDLayoutWorker {
+    public:
+        // step function, return false if all done
+        using StepFunc = bool(*)(void* ctx);
+        // ctor
+        CEDLayoutWorker() noexcept {}
+        // dtor
+        ~CEDLayoutWorker() noexcept;
+        // no copy ctor
+        CEDLayoutWorker(const CEDLayoutWorker&) noexcept = delete;
+        // start or resume running step function, false if thread not created
+        bool Resume(StepFunc, void* ctx) noexcept;
+        // pause and wait for current step, return step count since resume
+        auto Pause() noexcept->uint32_t;
+        // is running
+        bool IsRunning() const noexcept { return m_bRunning; }
+    private:
+        // thread entry
+        void run() noexcept;
+        // create worker thread
+        bool create() noexcept;
+    private:
+        // worker thread, created on first resume
+        std::thread             m_thread;
+        // mutex for state below
+        std::mutex              m_mutex;
+        // state changed
+        std::condition_variable m_cv;
+        // step function
+        StepFunc                m_fnStep = nullptr;
+        // step context
+        void*                   m_pContext = nullptr;
+        // step count since resume
+        uint32_t                m_cStep = 0;
+        // pause request, checked between steps
+        std::atomic<bool>       m_bPause{ false };
+        // worker is stepping
+        bool                    m_bWorking = false;
+        // worker should exit
+        bool                    m_bExit = false;
+        // resumed but not paused[owner side]
+        bool                    m_bRunning = false;
+    };
+    // persistent worker threads for parallel layout, thread created on first use and
+    // kept until destruction, so repeated runs do not spawn threads again.
+    // the document runs it only with Flag_ThreadSafePlatform, serial on caller otherwise
+    class CEDLayoutPool {
+    public:
+        // step function, return false if no task left
+        using StepFunc = CEDLayoutWorker::StepFunc;
+        // run step function on caller and (count - 1) workers until no task left,
+        // return thread count actually used
+        auto Run(StepFunc, void* ctx, uint32_t count) noexcept->uint32_t;
+    private:
+        // workers, caller thread is the extra one
+        CEDLayoutWorker         m_workers[LAYOUT_PARALLEL_THREAD - 1];
+    };
+}
@@ -113,6 +113,53 @@ void RichED::CEDUndoRedo::Clear() noexcept {
     m_cCurrent = 0;
 }
 
+/// <summary>
+/// Drops older half of history at op boundary.
+/// </summary>
+/// <returns>false if nothing dropped</returns>
+bool RichED::CEDUndoRedo::DropOlder() noexcept {
+    uint32_t count = 0;
+    for (auto node = m_head.next; node != &m_tail; node = node->next) ++count;
+    // 保留较新的一半, 截断于一组操作的最后(decorator为0)
+    Node* last = &m_head;
+    bool top_kept = m_pStackTop == &m_tail;
+    for (uint32_t i = 0; last->next != &m_tail; ++i) {
+        const auto node = last->next;
+        if (i >= count / 2 && (last == &m_head || !static_cast<TrivialUndoRedo*>(last)->decorator)) break;
+        top_kept |= node == m_pStackTop;
+        last = node;
+    }
+    if (last->next == &m_tail) return false;
+    auto node = last->next;
+    while (node != &m_tail) {
+        const auto ptr = node;
+        node = node->next;
+        RichED::Free(ptr);
+    }
+    last->next = &m_tail;
+    m_tail.prev = last;
+    if (!top_kept) m_pStackTop = &m_tail;
+    return true;
+}
+
+/// <summary>
+/// Gets op count and bytes of all history.
+/// </summary>
+/// <param name="count">The count.</param>
+/// <param name="bytes">The bytes.</param>
+/// <returns></returns>
+void RichED::CEDUndoRedo::GetStats(uint32_t& count, size_t& bytes) const noexcept {
+    count = 0; bytes = 0;
+    for (auto node = m_head.next; node != &m_tail; node = node->next) {
+        const auto op = static_cast<const TrivialUndoRedo*>(node);
+        // 记录从头部到bytes_from_here末尾: 非标准布局, 不用offsetof
+        const auto head = reinterpret_cast<const char*>(op);
+        const auto here = reinterpret_cast<const char*>(&op->bytes_from_here);
+        ++count;
+        bytes += size_t(here - head) + op->bytes_from_here;
+    }
+}
+
 /// <summary>
 /// Undoes the specified document.
 /// </summary>
@@ -278,8 +325,6 @@ namespace RichED {
 namespace RichED {
     // singe op for rich
     struct RubySingeOp {
-        // under riched
-        RichData        riched;
         // begin point
         DocPoint        begin;
         // ruby length
@@ -288,6 +333,8 @@ namespace RichED {
         uint32_t        under_length;
         // char
         char32_t        ch;
+        // under style id
+        uint16_t        style;
         // ruby
         char16_t        ruby[2];
     };
@@ -305,7 +352,9 @@ namespace RichED {
         ruby.first = obj->ruby;
         ruby.second = ruby.first + obj->ruby_length;
         assert(ruby.second > ruby.first);
-        doc.InsertRuby(obj->begin, obj->ch, ruby, &obj->riched);
+        // 复制一份, 插入时样式表可能变化
+        const RichData riched = doc.RefStyle(obj->style);
+        doc.InsertRuby(obj->begin, obj->ch, ruby, &riched);
     }
 }
 
@@ -333,7 +382,8 @@ namespace RichED {
     // Rollback rich
     void RollbackRich(CEDTextDocument& doc, TrivialUndoRedo& op) noexcept {
         const auto data = reinterpret_cast<RichGroupOp*>(&op + 1);
-        const auto ptr = reinterpret_cast<char*>(&data->back.riched) + data->back_offset;
+        const RichData riched = doc.RefStyle(data->back.style);
+        const auto ptr = reinterpret_cast<const char*>(&riched) + data->back_offset;
         if (data->back_length) {
             CEDTextDocument::UndoPri::SetRichED(
                 doc, data->back.begin, data->back.end,
@@ -343,7 +393,7 @@ namespace RichED {
         }
         // 长度为0则是设置FLAG
         else {
-            const uint16_t flags = static_cast<uint16_t>(data->back.riched.fflags);
+            const uint16_t flags = static_cast<uint16_t>(riched.fflags);
             CEDTextDocument::UndoPri::SetFlagS(
                 doc, data->back.begin, data->back.end,
                 flags, data->back_offset
@@ -357,10 +407,11 @@ namespace RichED {
         const auto end_itr = reinterpret_cast<RichSingeOp*>(end_ptr);
         const auto relayout = data->relayout;
         std::for_each(data->exec, end_itr, [&doc, relayout](const RichSingeOp& op)noexcept {
+            const RichData riched = doc.RefStyle(op.style);
             CEDTextDocument::UndoPri::SetRichED(
                 doc, op.begin, op.end,
-                0, sizeof(op.riched),
-                &op.riched, relayout
+                0, sizeof(riched),
+                &riched, relayout
             );
         });
     }
@@ -480,14 +531,14 @@ namespace RichED {
         /// </summary>
         /// <param name="ptr">The PTR.</param>
         /// <param name="index">The index.</param>
-        /// <param name="data">The data.</param>
+        /// <param name="style">The style.</param>
         /// <returns></returns>
-        void rich_set(void* ptr, uint32_t index, const RichData & data, DocPoint a, DocPoint b) noexcept {
+        void rich_set(void* ptr, uint32_t index, uint16_t style, DocPoint a, DocPoint b) noexcept {
             assert(ptr);
             assert(a.line != b.line || a.pos != b.pos);
             const auto op = reinterpret_cast<TrivialUndoRedo*>(ptr);
             const auto ops = reinterpret_cast<RichGroupOp*>(op + 1);
-            ops->exec[index].riched = data;
+            ops->exec[index].style = style;
             ops->exec[index].begin = a;
             ops->exec[index].end = b;
         }
@@ -638,12 +689,12 @@ namespace RichED {
         /// <param name="dp">The dp.</param>
         /// <param name="ch">The ch.</param>
         /// <param name="view">The view.</param>
-        /// <param name="data">The data.</param>
+        /// <param name="style">The style.</param>
         /// <returns></returns>
-        void ruby_set_data(void* ptr, DocPoint dp, char32_t ch, U16View view, const RichData& data) noexcept {
+        void ruby_set_data(void* ptr, DocPoint dp, char32_t ch, U16View view, uint16_t style) noexcept {
             const auto op = reinterpret_cast<TrivialUndoRedo*>(ptr);
             const auto obj = reinterpret_cast<RubySingeOp*>(op + 1);
-            obj->riched = data;
+            obj->style = style;
             obj->begin = dp;
             obj->ruby_length = static_cast<uint32_t>(view.second - view.first);
             obj->under_length = ch > 0xffff ? 2 : 1;
@@ -794,6 +845,38 @@ namespace RichED {
 }
 
 
+/// <summary>
+/// Visits style ids held by all history.
+/// </summary>
+/// <param name="ctx">The CTX.</param>
+/// <param name="call">The call, may modify the id.</param>
+/// <returns></returns>
+void RichED::CEDUndoRedo::VisitStyle(void* ctx, void(*call)(void* ctx, uint16_t& style)) noexcept {
+    for (auto node = m_head.next; node != &m_tail; node = node->next) {
+        const auto op = static_cast<TrivialUndoRedo*>(node);
+        switch (op->type)
+        {
+        case Op_SetAsRich:
+            // 修改富属性: 回滚用的样式
+            call(ctx, reinterpret_cast<RichGroupOp*>(op + 1)->back.style);
+            // 执行用的样式同移除富属性
+        case Op_RemoveRich:
+        {
+            const auto data = reinterpret_cast<RichGroupOp*>(op + 1);
+            const auto end_ptr = reinterpret_cast<char*>(&op->bytes_from_here) + op->bytes_from_here;
+            const auto end_itr = reinterpret_cast<RichSingeOp*>(end_ptr);
+            for (auto itr = data->exec; itr != end_itr; ++itr) call(ctx, itr->style);
+            break;
+        }
+        case Op_InsertRuby:
+            call(ctx, reinterpret_cast<RubySingeOp*>(op + 1)->style);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 //                             RichED Save/Load
 // ----------------------------------------------------------------------------
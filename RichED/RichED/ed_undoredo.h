@@ -65,6 +65,12 @@ namespace RichED {
         bool Undo(CEDTextDocument& doc) noexcept;
         // redo
         bool Redo(CEDTextDocument& doc) noexcept;
+        // get op count and bytes of all history
+        void GetStats(uint32_t& count, size_t& bytes) const noexcept;
+        // drop older half of history at op boundary, return false if nothing dropped
+        bool DropOlder() noexcept;
+        // visit style ids held by all history, call may modify the id
+        void VisitStyle(void* ctx, void(*call)(void* ctx, uint16_t& style)) noexcept;
     public:
         // fixed length 
         uint32_t      const max_deep;
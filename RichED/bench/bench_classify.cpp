@@ -0,0 +1,142 @@
+﻿// char classification kernel vs per-unit loop:
+//  classify: masks of 32-unit windows, ClassifyChars vs one branch per unit
+//  nearest : last space or CJK ideograph in the 64 units before a position,
+//            bit scan of cached candidate bitmap vs backward loop
+// usage: bench_classify [units=4194304] [rounds=5]
+
+#include "bench_plat.h"
+#include "../RichED/ed_txtbreak.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace RichED;
+
+namespace {
+    // is CJK ideograph in bmp, same ranges as ClassifyChars
+    inline bool is_cjk(uint16_t ch) noexcept {
+        return uint16_t(ch - 0x4E00) < 0x5200 || uint16_t(ch - 0x3400) < 0x19C0 || uint16_t(ch - 0xF900) < 0x200;
+    }
+    // classify one unit at a time
+    void classify_loop(const char16_t* str, uint32_t len, CharMasks& masks) noexcept {
+        masks = {};
+        for (uint32_t i = 0; i != len; ++i) {
+            const uint16_t ch = str[i];
+            const uint32_t bit = uint32_t(1) << i;
+            if (ch == ' ') masks.space |= bit;
+            else if (uint16_t((ch | 0x20) - 'a') < 26 || uint16_t(ch - '0') < 10) masks.alnum |= bit;
+            else if ((ch & 0xF800) == 0xD800) masks.surrogate |= bit;
+            else if (is_cjk(ch)) masks.cjk |= bit;
+        }
+    }
+    // last space or CJK in [begin, end), scanned back unit by unit, surrogate pairs skipped
+    uint32_t nearest_loop(const char16_t* str, uint32_t begin, uint32_t end) noexcept {
+        for (uint32_t i = end; i > begin; ) {
+            const uint16_t ch = str[--i];
+            if (ch == ' ') return i;
+            if ((ch & 0xFC00) == 0xDC00) { if (i > begin) --i; continue; }
+            if (is_cjk(ch)) return i;
+        }
+        return end;
+    }
+    // break candidates of whole text: space or CJK, computed once like the per-line cache
+    std::vector<uint32_t> make_bits(const std::u16string& s) {
+        std::vector<uint32_t> bits(s.size() / 32 + 1);
+        CharMasks masks;
+        for (size_t i = 0; i < s.size(); i += 32) {
+            ClassifyChars(s.data() + i, uint32_t(std::min<size_t>(32, s.size() - i)), masks);
+            bits[i >> 5] = masks.space | masks.cjk;
+        }
+        return bits;
+    }
+    // generate latin or cjk text
+    std::u16string make_text(bool cjk, size_t len) {
+        std::mt19937 rng{ 1 };
+        std::u16string s;
+        while (s.size() < len) {
+            if (cjk) {
+                s += char16_t(0x4E00 + rng() % 0x5000);
+                if (rng() % 12 == 0) s += u'\x3002';
+                if (rng() % 50 == 0) s += char16_t(0xD840), s += char16_t(0xDC00 + rng() % 64);
+            }
+            else {
+                // 长单词较多时才能体现逐字扫描的代价
+                for (uint32_t i = 0, n = 1 + rng() % 24; i != n; ++i) s += char16_t('a' + rng() % 26);
+                s += rng() % 8 ? u" " : u", ";
+            }
+        }
+        return s;
+    }
+    // best time of rounds in ms
+    template<typename T> double best_of(uint32_t rounds, T call) noexcept {
+        double best = 1e30;
+        for (uint32_t r = 0; r != rounds; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            call();
+            best = std::min(best, bench::Ms(start));
+        }
+        return best;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const size_t units = argc > 1 ? size_t(std::atoll(argv[1])) : size_t(1) << 22;
+    const uint32_t rounds = argc > 2 ? uint32_t(std::atoi(argv[2])) : 5;
+    for (const bool cjk : { false, true }) {
+        const auto s = make_text(cjk, units);
+        const auto len = uint32_t(s.size());
+        // 分类: 逐窗口比较结果
+        volatile uint32_t sink = 0;
+        for (uint32_t i = 0; i < len; i += 32) {
+            CharMasks a, b;
+            const auto n = std::min(32u, len - i);
+            classify_loop(s.data() + i, n, a);
+            ClassifyChars(s.data() + i, n, b);
+            if (a.space != b.space || a.alnum != b.alnum || a.cjk != b.cjk || a.surrogate != b.surrogate) {
+                std::printf("classify mismatch at %u\n", i);
+                return 1;
+            }
+        }
+        const auto classify = [&](void(*fn)(const char16_t*, uint32_t, CharMasks&)) {
+            return best_of(rounds, [&]() noexcept {
+                uint32_t acc = 0;
+                for (uint32_t i = 0; i < len; i += 32) {
+                    CharMasks m;
+                    fn(s.data() + i, std::min(32u, len - i), m);
+                    acc += m.space ^ m.alnum ^ m.cjk ^ m.surrogate;
+                }
+                sink = acc;
+            });
+        };
+        const auto t_loop = classify(classify_loop);
+        const auto t_simd = classify(ClassifyChars);
+        // 最近断点: 随机位置
+        std::mt19937 rng{ 2 };
+        std::vector<uint32_t> pos(1 << 20);
+        for (auto& p : pos) p = 64 + rng() % (len - 64);
+        const auto bits = make_bits(s);
+        for (const auto p : pos) {
+            if (nearest_loop(s.data(), p - 64, p) != FindBitBackward(bits.data(), p - 64, p)) {
+                std::printf("nearest mismatch at %u\n", p);
+                return 1;
+            }
+        }
+        const auto n_loop = best_of(rounds, [&]() noexcept {
+            uint32_t acc = 0;
+            for (const auto p : pos) acc += nearest_loop(s.data(), p - 64, p);
+            sink = acc;
+        });
+        const auto n_scan = best_of(rounds, [&]() noexcept {
+            uint32_t acc = 0;
+            for (const auto p : pos) acc += FindBitBackward(bits.data(), p - 64, p);
+            sink = acc;
+        });
+        std::printf("%-5s classify: loop %7.1f Munit/s  kernel %7.1f Munit/s  x%.2f\n",
+            cjk ? "cjk" : "latin", len / t_loop / 1e3, len / t_simd / 1e3, t_loop / t_simd);
+        std::printf("%-5s nearest : loop %7.1f Mop/s    scan   %7.1f Mop/s    x%.2f\n",
+            cjk ? "cjk" : "latin", pos.size() / n_loop / 1e3, pos.size() / n_scan / 1e3, n_loop / n_scan);
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+﻿// full-document layout: cells pasted in order vs lines inserted at random places
+// (list order != memory order, every hop of the layout walk a likely cache miss)
+// usage: bench_layout [lines=100000] [rounds=7]
+
+#include "bench_plat.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace RichED;
+
+int main(int argc, char* argv[]) {
+    const uint32_t lines = argc > 1 ? uint32_t(std::atoi(argv[1])) : 100000;
+    const uint32_t rounds = argc > 2 ? uint32_t(std::atoi(argv[2])) : 7;
+    const auto text = bench::MakeText(lines, 7);
+    std::printf("lines=%u\n", lines);
+    for (const auto wrap : { Mode_NoWrap, Mode_SpaceOnly }) {
+        for (const bool scatter : { false, true }) {
+            CEDBenchPlatform plat;
+            const auto arg = bench::MakeArg(wrap);
+            CEDTextDocument doc{ plat, arg };
+            if (!arg.IsOK()) { std::printf("oom\n"); return 1; }
+            // 视口覆盖全文: Update布局所有行
+            doc.ResizeViewport({ 400, 1e30f });
+            if (scatter) {
+                // 逐行插入随机位置
+                std::mt19937 rng{ 7 };
+                size_t begin = 0;
+                while (begin < text.size()) {
+                    auto end = text.find(u'\n', begin);
+                    end = end == std::u16string::npos ? text.size() : end + 1;
+                    const DocPoint dp = { uint32_t(rng() % doc.GetLogicLineCount()), 0 };
+                    doc.InsertText(dp, { text.data() + begin, text.data() + end });
+                    begin = end;
+                }
+            }
+            else doc.InsertText({ 0, 0 }, bench::View(text));
+            auto start = std::chrono::steady_clock::now();
+            doc.Update();
+            const auto first = bench::Ms(start);
+            const size_t recreated = plat.recreate;
+            // 重新布局: 全部标记为脏后再次布局
+            double best = 1e30;
+            for (uint32_t i = 0; i != rounds; ++i) {
+                doc.ForceResetAllRiched();
+                start = std::chrono::steady_clock::now();
+                doc.Update();
+                best = std::min(best, bench::Ms(start));
+            }
+            std::printf("wrap=%d %-9s recreate=%6zu  first %7.1f ms  relayout(best of %u) %7.1f ms\n",
+                int(wrap), scatter ? "scattered" : "pasted", recreated, first, rounds, best);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+﻿// line breaker [UAX #14] throughput: 4M utf-16 units fed in 64-unit chunks (cell size)
+// usage: bench_linebreak [units=4194304] [rounds=5]
+
+#include "bench_plat.h"
+#include "../RichED/ed_txtbreak.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace RichED;
+
+// text kind
+enum TextKind { Kind_Latin, Kind_CJK, Kind_Mixed };
+
+// generate text of kind, at least len units
+static auto make_text(TextKind kind, size_t len) {
+    std::mt19937 rng{ 1 };
+    std::u16string s;
+    while (s.size() < len) {
+        switch (kind)
+        {
+        case Kind_Latin:
+            for (uint32_t i = 0, n = 1 + rng() % 9; i != n; ++i) s += char16_t('a' + rng() % 26);
+            s += rng() % 8 ? u" " : u", ";
+            break;
+        case Kind_CJK:
+            s += char16_t(0x4E00 + rng() % 0x5000);
+            if (rng() % 12 == 0) s += u'\x3002';
+            break;
+        case Kind_Mixed:
+            if (rng() % 2) s += u"word ";
+            else s += char16_t(0x4E00 + rng() % 0x5000), s += char16_t(0x3041 + rng() % 80);
+            // 偶尔出现emoji
+            if (rng() % 50 == 0) s += char16_t(0xD83D), s += char16_t(0xDE00 + rng() % 64);
+            break;
+        }
+    }
+    return s;
+}
+
+int main(int argc, char* argv[]) {
+    const size_t units = argc > 1 ? size_t(std::atoll(argv[1])) : size_t(1) << 22;
+    const uint32_t rounds = argc > 2 ? uint32_t(std::atoi(argv[2])) : 5;
+    const char* const names[] = { "latin", "cjk", "mixed" };
+    for (const auto kind : { Kind_Latin, Kind_CJK, Kind_Mixed }) {
+        const auto s = make_text(kind, units);
+        std::vector<uint32_t> bits(s.size() / 32 + 1);
+        double best = 1e30;
+        for (uint32_t r = 0; r != rounds; ++r) {
+            std::fill(bits.begin(), bits.end(), 0);
+            const auto start = std::chrono::steady_clock::now();
+            CEDLineBreaker breaker;
+            // 按CELL大小分段输入
+            for (size_t i = 0; i < s.size(); i += 64) {
+                const auto len = uint32_t(std::min<size_t>(64, s.size() - i));
+                breaker.Feed(s.data() + i, len, bits.data(), uint32_t(i));
+            }
+            best = std::min(best, bench::Ms(start));
+        }
+        size_t breaks = 0;
+        for (auto word : bits) for (; word; word &= word - 1) ++breaks;
+        std::printf("%-6s %7.1f MB/s  %6.1f Munit/s  breaks=%zu\n", names[kind],
+            s.size() * sizeof(char16_t) / best / 1e3, s.size() / best / 1e3, breaks);
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+﻿// memory per char: paste a document, lay it out, then type single chars at random places
+// usage: bench_memory [lines=20000] [inserts=20000]
+
+#include "bench_plat.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace RichED;
+
+int main(int argc, char* argv[]) {
+    const uint32_t lines = argc > 1 ? uint32_t(std::atoi(argv[1])) : 20000;
+    const uint32_t inserts = argc > 2 ? uint32_t(std::atoi(argv[2])) : 20000;
+    const auto text = bench::MakeText(lines, 42);
+    for (const auto wrap : { Mode_NoWrap, Mode_SpaceOnly }) {
+        const auto base = bench::LiveBytes();
+        {
+            CEDBenchPlatform plat;
+            const auto arg = bench::MakeArg(wrap);
+            CEDTextDocument doc{ plat, arg };
+            if (!arg.IsOK()) { std::printf("oom\n"); return 1; }
+            // 视口覆盖全文: Update布局所有行
+            doc.ResizeViewport({ 400, 1e30f });
+            // 粘贴
+            doc.InsertText({ 0, 0 }, bench::View(text));
+            doc.Update();
+            const double pasted = double(doc.RefInfo().total_length);
+            const auto after_paste = bench::LiveBytes() - base;
+            // 随机位置逐字输入
+            std::mt19937 rng{ 42 };
+            for (uint32_t i = 0; i != inserts; ++i) {
+                const char16_t ch = u"abcdefgh \x4e2d"[rng() % 10];
+                const DocPoint dp = { uint32_t(rng() % doc.GetLogicLineCount()), uint32_t(rng() % 50) };
+                doc.InsertText(dp, { &ch, &ch + 1 });
+            }
+            doc.Update();
+            const double typed = double(doc.RefInfo().total_length);
+            const auto after_type = bench::LiveBytes() - base;
+            std::printf("wrap=%d chars=%.0f  paste %.2f B/char  typing %.2f B/char\n",
+                int(wrap), typed, after_paste / pasted, after_type / typed);
+        }
+        if (bench::LiveBytes() != base) { std::printf("leak: %zu bytes\n", bench::LiveBytes() - base); return 1; }
+    }
+    return 0;
+}
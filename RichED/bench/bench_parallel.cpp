@@ -0,0 +1,43 @@
+﻿// parallel layout: LayoutAll on 1M lines with 1..16 threads, result checked against serial.
+// speed-up only means something while threads <= hardware threads, rows above are marked
+// usage: bench_parallel [lines=1000000] [max_threads=16]
+
+#include "bench_plat.h"
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace RichED;
+
+int main(int argc, char* argv[]) {
+    const uint32_t lines = argc > 1 ? uint32_t(std::atoi(argv[1])) : 1000000;
+    const uint32_t max_threads = argc > 2 ? uint32_t(std::atoi(argv[2])) : 16;
+    const auto text = bench::MakeText(lines);
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    std::printf("lines=%u hardware threads=%u\n", lines, hardware);
+    if (hardware < 2) std::printf("single hardware thread: no speed-up can be measured here\n");
+    for (const auto wrap : { Mode_NoWrap, Mode_SpaceOrCJK }) {
+        double serial = 0;
+        Size serial_size = {};
+        for (uint32_t threads = 1; threads <= max_threads; threads *= 2) {
+            CEDBenchPlatform plat;
+            const auto arg = bench::MakeArg(wrap, Flag_MultiLine | Flag_RichText | Flag_ThreadSafePlatform);
+            CEDTextDocument doc{ plat, arg };
+            if (!arg.IsOK() || !doc.Assign(bench::View(text))) { std::printf("oom\n"); return 1; }
+            doc.ResizeViewport({ 400, 300 });
+            doc.Update();
+            const auto start = std::chrono::steady_clock::now();
+            doc.LayoutAll(threads);
+            const auto ms = bench::Ms(start);
+            const auto size = doc.GetEstimatedSize();
+            if (threads == 1) serial = ms, serial_size = size;
+            // 并行结果必须与串行一致
+            const bool same = size.width == serial_size.width && size.height == serial_size.height;
+            std::printf("wrap=%d threads=%2u %9.1f ms  x%.2f  height=%.0f%s%s\n",
+                int(wrap), threads, ms, serial / ms, size.height,
+                threads > hardware ? "  oversubscribed" : "", same ? "" : "  MISMATCH");
+            if (!same) return 1;
+        }
+    }
+    return 0;
+}
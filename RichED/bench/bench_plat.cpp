@@ -0,0 +1,180 @@
+﻿#include "bench_plat.h"
+#include <cstdlib>
+#include <random>
+
+namespace RichED { namespace bench {
+    // live bytes
+    static std::atomic<size_t> s_live{ 0 };
+    // alloc header: keeps max_align_t alignment
+    enum : size_t { ALLOC_HEAD = alignof(std::max_align_t) };
+}}
+
+/// <summary>
+/// Allocs memory, size recorded in front of block.
+/// </summary>
+/// <param name="len">The length.</param>
+/// <returns></returns>
+void* RichED::Alloc(size_t len) noexcept {
+    const auto ptr = static_cast<char*>(std::malloc(len + bench::ALLOC_HEAD));
+    if (!ptr) return nullptr;
+    *reinterpret_cast<size_t*>(ptr) = len;
+    bench::s_live += len;
+    return ptr + bench::ALLOC_HEAD;
+}
+
+/// <summary>
+/// Frees the specified memory.
+/// </summary>
+/// <param name="ptr">The PTR.</param>
+/// <returns></returns>
+void RichED::Free(void* ptr) noexcept {
+    if (!ptr) return;
+    const auto real = static_cast<char*>(ptr) - bench::ALLOC_HEAD;
+    bench::s_live -= *reinterpret_cast<size_t*>(real);
+    std::free(real);
+}
+
+/// <summary>
+/// Re-allocs memory.
+/// </summary>
+/// <param name="ptr">The PTR.</param>
+/// <param name="len">The length.</param>
+/// <returns></returns>
+void* RichED::ReAlloc(void* ptr, size_t len) noexcept {
+    if (!ptr) return RichED::Alloc(len);
+    const auto real = static_cast<char*>(ptr) - bench::ALLOC_HEAD;
+    const auto old = *reinterpret_cast<size_t*>(real);
+    const auto now = static_cast<char*>(std::realloc(real, len + bench::ALLOC_HEAD));
+    if (!now) return nullptr;
+    *reinterpret_cast<size_t*>(now) = len;
+    bench::s_live += len;
+    bench::s_live -= old;
+    return now + bench::ALLOC_HEAD;
+}
+
+/// <summary>
+/// Live bytes.
+/// </summary>
+/// <returns></returns>
+auto RichED::bench::LiveBytes() noexcept -> size_t {
+    return s_live;
+}
+
+/// <summary>
+/// Makes the init arg.
+/// </summary>
+/// <param name="wrap">The wrap mode.</param>
+/// <param name="flags">The flags.</param>
+/// <returns></returns>
+auto RichED::bench::MakeArg(WrapMode wrap, DocFlag flags) noexcept -> DocInitArg {
+    DocInitArg arg = {};
+    arg.read = Direction_L2R;
+    arg.flow = Direction_T2B;
+    arg.flags = flags;
+    arg.length_max = 1u << 30;
+    arg.fixed_lineheight = 20;
+    arg.valign = VAlign_Baseline;
+    arg.talign = TAlign_Leading;
+    arg.wrap_mode = wrap;
+    arg.riched.size = 16;
+    arg.riched.color = 0xff000000;
+    return arg;
+}
+
+/// <summary>
+/// Makes the text.
+/// </summary>
+/// <param name="lines">The line count.</param>
+/// <param name="seed">The seed.</param>
+/// <returns></returns>
+auto RichED::bench::MakeText(uint32_t lines, uint32_t seed) -> std::u16string {
+    static const char* const words[] = {
+        "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+        "lorem", "ipsum", "dolor", "sit", "amet", "layout", "cell", "editor",
+    };
+    std::mt19937 rng{ seed };
+    std::u16string text;
+    for (uint32_t l = 0; l != lines; ++l) {
+        // 偶尔出现需要自动换行的长行
+        uint32_t n = rng() % 14;
+        if (rng() % 32 == 0) n += rng() % 64;
+        for (uint32_t i = 0; i != n; ++i) {
+            for (auto p = words[rng() % 16]; *p; ++p) text += char16_t(*p);
+            text += u' ';
+        }
+        if (l + 1 != lines) text += u'\n';
+    }
+    return text;
+}
+
+/// <summary>
+/// Called when out of memory.
+/// </summary>
+/// <returns></returns>
+auto RichED::CEDBenchPlatform::OnOOM(size_t, size_t) noexcept -> HandleOOM {
+    return OOM_Ignore;
+}
+
+/// <summary>
+/// Appends the text.
+/// </summary>
+/// <param name="ctx">The std::u16string.</param>
+/// <param name="view">The view.</param>
+/// <returns></returns>
+bool RichED::CEDBenchPlatform::AppendText(CtxPtr ctx, U16View view) noexcept {
+    static_cast<std::u16string*>(ctx)->append(view.first, view.second);
+    return true;
+}
+
+/// <summary>
+/// Recreates the context: advance = size / 2 per char.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <returns></returns>
+void RichED::CEDBenchPlatform::RecreateContext(CEDTextCell& cell) noexcept {
+    ++recreate;
+    cell.ctx.context = &cell;
+    if (!cell.RefMetaInfo().dirty) return;
+    const auto size = cell.RefRichED().size;
+    if (cell.RefMetaInfo().metatype >= Type_InlineObject) cell.metrics.width = size;
+    else cell.metrics.width = times(half(size), cell.RefString().length);
+    cell.metrics.ar_height = size * 0.8f;
+    cell.metrics.dr_height = size * 0.2f;
+    cell.metrics.bounding = { 0, 0, cell.metrics.width, size };
+    cell.AsClean();
+}
+
+/// <summary>
+/// Hits the test.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <param name="offset">The offset.</param>
+/// <returns></returns>
+auto RichED::CEDBenchPlatform::HitTest(CEDTextCell& cell, unit_t offset) noexcept -> CellHitTest {
+    ++hittest;
+    CellHitTest rv = { 0, 0, 1 };
+    const auto length = cell.RefString().length;
+    if (!length) return rv;
+    if (cell.RefMetaInfo().metatype >= Type_InlineObject) {
+        rv.trailing = offset >= half(cell.metrics.width);
+        return rv;
+    }
+    const auto advance = half(cell.RefRichED().size);
+    const auto pos = offset > 0 ? uint32_t(offset / advance) : 0;
+    if (pos >= length) { rv.pos = length - 1; rv.trailing = 1; }
+    else rv.pos = pos;
+    return rv;
+}
+
+/// <summary>
+/// Gets the character metrics.
+/// </summary>
+/// <param name="cell">The cell.</param>
+/// <param name="pos">The position.</param>
+/// <returns></returns>
+auto RichED::CEDBenchPlatform::GetCharMetrics(CEDTextCell& cell, uint32_t pos) noexcept -> CharMetrics {
+    if (cell.RefMetaInfo().metatype >= Type_InlineObject)
+        return { pos ? cell.metrics.width : 0, pos ? 0 : cell.metrics.width };
+    const auto advance = half(cell.RefRichED().size);
+    return { times(advance, pos), advance };
+}
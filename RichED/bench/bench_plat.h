@@ -0,0 +1,60 @@
+﻿#pragma once
+// headless platform for benchmarks: fixed-advance metrics, no drawing,
+// no system font api, thread-safe for parallel layout
+
+#include "../RichED/ed_txtplat.h"
+#include "../RichED/ed_txtdoc.h"
+#include "../RichED/ed_txtcell.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// riched namespace
+namespace RichED {
+    // headless platform
+    struct CEDBenchPlatform final : IEDTextPlatform {
+        // RecreateContext call count
+        std::atomic<size_t>     recreate{ 0 };
+        // HitTest call count
+        std::atomic<size_t>     hittest{ 0 };
+        // on out of memory
+        auto OnOOM(size_t retry_count, size_t try_alloc) noexcept->HandleOOM override;
+        // is valid password
+        bool IsValidPassword(char32_t) noexcept override { return true; }
+        // append text, ctx as std::u16string
+        bool AppendText(CtxPtr ctx, U16View view) noexcept override;
+        // write to file
+        bool WriteToFile(CtxPtr, const uint8_t[], uint32_t) noexcept override { return false; }
+        // read from file
+        bool ReadFromFile(CtxPtr, uint8_t[], uint32_t) noexcept override { return false; }
+        // recreate context
+        void RecreateContext(CEDTextCell& cell) noexcept override;
+        // delete context
+        void DeleteContext(CEDTextCell& cell) noexcept override { cell.ctx.context = nullptr; }
+        // draw context
+        void DrawContext(CtxPtr, CEDTextCell&, unit_t) noexcept override {}
+        // hit test
+        auto HitTest(CEDTextCell&, unit_t offset) noexcept->CellHitTest override;
+        // get char metrics
+        auto GetCharMetrics(CEDTextCell&, uint32_t pos) noexcept->CharMetrics override;
+#ifndef NDEBUG
+        // debug output
+        void DebugOutput(const char*, bool) noexcept override {}
+#endif
+    };
+    // benchmark helper
+    namespace bench {
+        // bytes allocated through RichED::Alloc and not freed
+        auto LiveBytes() noexcept->size_t;
+        // init arg of multi-line document
+        auto MakeArg(WrapMode wrap, DocFlag flags = Flag_MultiLine | Flag_RichText) noexcept->DocInitArg;
+        // generate text: lines of random ascii words, same seed same text
+        auto MakeText(uint32_t lines, uint32_t seed = 1)->std::u16string;
+        // view of string
+        inline U16View View(const std::u16string& s) noexcept { return { s.data(), s.data() + s.size() }; }
+        // milliseconds since start
+        template<typename T> double Ms(T start) noexcept {
+            const std::chrono::duration<double, std::milli> d = std::chrono::steady_clock::now() - start;
+            return d.count(); }
+    }
+}
@@ -0,0 +1,72 @@
+﻿// regression check: random edits mixed with Compact, each followed by a layout
+// (Compact may move cells, no visual line kept after it may point at a freed cell)
+// built without NDEBUG so the layout asserts are live
+// usage: check_compact [seeds=400] [steps=800]
+
+#include "bench_plat.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace RichED;
+
+int main(int argc, char* argv[]) {
+    const uint32_t seeds = argc > 1 ? uint32_t(std::atoi(argv[1])) : 400;
+    const uint32_t steps = argc > 2 ? uint32_t(std::atoi(argv[2])) : 800;
+    static const char16_t pool[] = u"abc de fghij klm\n\n\x4e2d\x6587 xyz\n";
+    for (uint32_t seed = 0; seed != seeds; ++seed) {
+        for (const auto wrap : { Mode_NoWrap, Mode_SpaceOnly }) {
+            std::mt19937 rng{ seed };
+            const auto base = bench::LiveBytes();
+            {
+                CEDBenchPlatform plat;
+                const auto arg = bench::MakeArg(wrap);
+                CEDTextDocument doc{ plat, arg };
+                if (!arg.IsOK()) { std::printf("oom\n"); return 1; }
+                doc.ResizeViewport({ 200, 300 });
+                // 随机的有效位置
+                const auto point = [&]() {
+                    const auto line = uint32_t(rng() % doc.GetLogicLineCount());
+                    std::u16string text;
+                    doc.GenText(&text, { line, 0 }, { line + 1, 0 });
+                    while (!text.empty() && (text.back() == u'\n' || text.back() == u'\r')) text.pop_back();
+                    return DocPoint{ line, uint32_t(rng() % (text.size() + 1)) };
+                };
+                for (uint32_t step = 0; step != steps; ++step) {
+                    // 光标不随其它位置的编辑移动, 先放回起点
+                    doc.SetAnchorCaret({ 0, 0 }, { 0, 0 });
+                    const auto op = rng() % 10;
+                    // 小段插入: 产生许多可以合并的CELL
+                    if (op < 4) {
+                        std::u16string s;
+                        for (uint32_t i = 0, n = 1 + rng() % 12; i != n; ++i)
+                            s += pool[rng() % (sizeof(pool) / sizeof(pool[0]) - 1)];
+                        doc.BeginOp(); doc.InsertText(point(), bench::View(s)); doc.EndOp();
+                    }
+                    else if (op < 5) {
+                        auto a = point(), b = point();
+                        if (b.line < a.line || (b.line == a.line && b.pos < a.pos)) std::swap(a, b);
+                        doc.BeginOp(); doc.RemoveText(a, b); doc.EndOp();
+                    }
+                    else if (op < 6) {
+                        const auto a = point(), b = point();
+                        doc.BeginOp(); doc.SetFontSize(a, b, unit_t(8 + rng() % 3 * 8)); doc.EndOp();
+                    }
+                    else if (op < 7) doc.GuiUndo();
+                    else if (op < 8) doc.ResizeViewport({ unit_t(100 + rng() % 300), 300 });
+                    else doc.Compact(uint32_t(rng() % doc.GetLogicLineCount()), 1 + rng() % 64);
+                    // 布局与光标刷新
+                    doc.Update();
+                    doc.Render(nullptr);
+                    doc.GuiLButtonDown({ unit_t(rng() % 300), unit_t(rng() % 320) }, false);
+                }
+            }
+            if (bench::LiveBytes() != base) {
+                std::printf("seed=%u wrap=%d leak: %zu bytes\n", seed, int(wrap), bench::LiveBytes() - base);
+                return 1;
+            }
+        }
+    }
+    std::printf("ok seeds=%u steps=%u\n", seeds, steps);
+    return 0;
+}
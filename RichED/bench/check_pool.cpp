@@ -0,0 +1,34 @@
+﻿// regression check: reserved cells come from one chunk in order,
+// even with freed objects waiting in the free-list
+// usage: check_pool
+
+#include "bench_plat.h"
+#include "../RichED/ed_txtpool.h"
+#include <cstdio>
+
+using namespace RichED;
+
+int main() {
+    CEDBenchPlatform plat;
+    const auto arg = bench::MakeArg(Mode_NoWrap);
+    CEDTextDocument doc{ plat, arg };
+    if (!arg.IsOK()) { std::printf("oom\n"); return 1; }
+    for (const uint32_t count : { 1u, 7u, 100u, 1000u }) {
+        CEDCellPool pool{ 48 };
+        const auto size = pool.GetObjectSize();
+        // 空闲链表中留下一些对象
+        void* objs[40];
+        for (auto& obj : objs) obj = pool.Alloc(doc);
+        for (uint32_t i = 0; i != 40; i += 2) pool.Free(objs[i]);
+        if (!pool.Reserve(doc, count)) { std::printf("oom\n"); return 1; }
+        const auto first = static_cast<char*>(pool.Alloc(doc));
+        for (uint32_t i = 1; i != count; ++i) {
+            if (pool.Alloc(doc) != first + size_t(size) * i) {
+                std::printf("count=%u: alloc %u not in reserved chunk\n", count, i);
+                return 1;
+            }
+        }
+    }
+    std::printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,41 @@
+﻿// regression check: undo across style table compaction
+// (compaction remaps the style ids held by undo records, newer history kept)
+// usage: check_style [after=2] [undo=6]
+
+#include "bench_plat.h"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace RichED;
+
+int main(int argc, char* argv[]) {
+    const uint32_t after = argc > 1 ? uint32_t(std::atoi(argv[1])) : 2;
+    const uint32_t undo = argc > 2 ? uint32_t(std::atoi(argv[2])) : 6;
+    CEDBenchPlatform plat;
+    const auto arg = bench::MakeArg(Mode_NoWrap);
+    CEDTextDocument doc{ plat, arg };
+    if (!arg.IsOK()) { std::printf("oom\n"); return 1; }
+    const char16_t text[] = u"abcdef";
+    doc.InsertText({ 0, 0 }, { text, text + 6 });
+    doc.SetAnchorCaret({ 0, 0 }, { 0, 6 });
+    // 中间字符的颜色
+    const auto color = [&doc]() noexcept {
+        uint32_t offset;
+        return doc.RefCellIndex().Find(3, offset)->RefRichED().color;
+    };
+    // 每次一个新颜色, 直到样式表被压缩: 旧样式都被撤销记录持有, 较旧的一半记录被舍弃
+    uint32_t c = 0;
+    while (!(doc.Update() & Changed_UndoDropped)) {
+        if (!doc.GuiFontColor(++c)) { std::printf("set color failed at %u\n", c); return 1; }
+        if (c > TEXT_STYLE_INVALID) { std::printf("style table never compacted\n"); return 1; }
+    }
+    for (uint32_t i = 0; i != after; ++i) doc.GuiFontColor(++c);
+    // 撤销越过压缩点: 颜色逐个恢复
+    for (uint32_t i = 0; i != undo; ++i) {
+        if (!doc.GuiUndo()) { std::printf("undo %u failed, history lost\n", i); return 1; }
+        if (color() != --c) { std::printf("undo %u: color %u, expected %u\n", i, unsigned(color()), c); return 1; }
+    }
+    if (!doc.GuiRedo() || color() != c + 1) { std::printf("redo failed\n"); return 1; }
+    std::printf("ok compacted at %u\n", c + undo - after);
+    return 0;
+}
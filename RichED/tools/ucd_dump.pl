@@ -0,0 +1,32 @@
+# Dumps the UCD properties used by ed_txtprop.cpp as "begin end value" ranges.
+# The Unicode version is the one bundled with perl (perl 5.36: Unicode 14.0.0).
+#
+#   perl ucd_dump.pl <out-dir>
+#   python3 ucd_tables.py <out-dir> ../RichED/ed_txtprop.cpp
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap prop_value_aliases);
+
+my $dir = shift // '.';
+printf STDERR "Unicode %s\n", Unicode::UCD::UnicodeVersion();
+
+sub dump_prop {
+    my ($prop, $file) = @_;
+    my ($ranges, $map) = prop_invmap($prop);
+    open my $f, '>', "$dir/$file" or die "$dir/$file: $!";
+    for my $i (0 .. $#$ranges) {
+        my $end = $i < $#$ranges ? $ranges->[$i + 1] : 0x110000;
+        my $value = $map->[$i];
+        # short alias, e.g. "AL" for "Alphabetic"
+        my @alias = prop_value_aliases($prop, $value);
+        printf $f "%X %X %s\n", $ranges->[$i], $end, @alias ? $alias[0] : $value;
+    }
+    close $f;
+}
+
+dump_prop('Line_Break', 'lb.txt');
+dump_prop('East_Asian_Width', 'ea.txt');
+dump_prop('General_Category', 'gc.txt');
+dump_prop('Grapheme_Cluster_Break', 'gcb.txt');
+dump_prop('Word_Break', 'wb.txt');
+dump_prop('Extended_Pictographic', 'ep.txt');
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Generates the property trie of ed_txtprop.cpp from ucd_dump.pl output.
+
+    python3 ucd_tables.py <dump-dir> <ed_txtprop.cpp> [--check]
+
+Replaces the block from "// record of properties" to the end of
+RED_PROP_STAGE3 in place; --check only reports whether it is up to date.
+Field layout of a record must match CharProperty in ed_txtprop.h.
+"""
+import sys
+
+N = 0x110000
+# value order = enum order in ed_txtprop.h
+LB = ['OP', 'CL', 'CP', 'QU', 'GL', 'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU', 'AL', 'HL',
+      'ID', 'IN', 'HY', 'BA', 'BB', 'B2', 'ZW', 'CM', 'WJ', 'H2', 'H3', 'JL', 'JV', 'JT',
+      'RI', 'EB', 'EM', 'ZWJ', 'CB', 'BK', 'CR', 'LF', 'NL', 'SP']
+EA = ['N', 'A', 'H', 'W', 'F', 'Na']
+GC = ['Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Ps',
+      'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs',
+      'Co', 'Cn']
+GB = ['XX', 'CR', 'LF', 'CN', 'EX', 'ZWJ', 'RI', 'PP', 'SM', 'L', 'V', 'T', 'LV', 'LVT']
+WB = ['XX', 'CR', 'LF', 'NL', 'Extend', 'ZWJ', 'RI', 'FO', 'KA', 'HL', 'LE', 'SQ', 'DQ',
+      'MB', 'ML', 'MN', 'NU', 'EX', 'WSegSpace']
+# WordBreakProperty.txt WSegSpace, perl reports it as Perl_Tailored_HSpace with tabs
+WSEG = {0x20, 0x1680, 0x2000, 0x2001, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006, 0x2008,
+        0x2009, 0x200A, 0x205F, 0x3000}
+# trie shifts: [ch >> 9][(ch >> 4) & 31][ch & 15]
+S1, S2 = 9, 4
+BEGIN = '// record of properties\n'
+
+
+def load(path):
+    values = [None] * N
+    for line in open(path):
+        begin, end, value = line.split()
+        begin, end = int(begin, 16), int(end, 16)
+        values[begin:end] = [value] * (end - begin)
+    return values
+
+
+def record(c, lb, ea, gc, gcb, wb, ep):
+    # line break classes resolved as CEDLineBreaker expects [LB1]
+    l = lb[c]
+    if l in ('AI', 'SG', 'XX'):
+        l = 'AL'
+    elif l == 'SA':
+        l = 'CM' if gc[c] in ('Mn', 'Mc') else 'AL'
+    elif l == 'CJ':
+        l = 'NS'
+    g = gcb[c][8:] if gcb[c].startswith('ExtPict_') else gcb[c]
+    w = wb[c][8:] if wb[c].startswith('ExtPict_') else wb[c]
+    if w == 'Perl_Tailored_HSpace':
+        w = 'WSegSpace' if c in WSEG else 'XX'
+    e = 1 if ep[c] == 'Y' else 0
+    return (LB.index(l) | GB.index(g) << 6 | e << 10 | WB.index(w) << 11 |
+            GC.index(gc[c]) << 16 | EA.index(ea[c]) << 21)
+
+
+def array(values, per, width):
+    fmt = '0x%0' + str(width) + 'X,'
+    return '\n'.join('    ' + ' '.join(fmt % v for v in values[i:i + per])
+                     for i in range(0, len(values), per))
+
+
+def generate(dump):
+    props = [load(dump + '/' + name) for name in
+             ('lb.txt', 'ea.txt', 'gc.txt', 'gcb.txt', 'wb.txt', 'ep.txt')]
+    records, rec = {}, [0] * N
+    for c in range(N):
+        rec[c] = records.setdefault(record(c, *props), len(records))
+    # stage 3: blocks of 16 records, stage 2: blocks of 32 stage-3 blocks
+    blocks, mid = {}, []
+    for b in range(0, N, 1 << S2):
+        mid.append(blocks.setdefault(tuple(rec[b:b + (1 << S2)]), len(blocks)))
+    mblocks, top = {}, []
+    step = 1 << (S1 - S2)
+    for b in range(0, len(mid), step):
+        top.append(mblocks.setdefault(tuple(mid[b:b + step]), len(mblocks)))
+    assert len(records) <= 256 and len(mblocks) <= 256 and len(blocks) <= 0xffff
+    stage2 = [x for t in mblocks for x in t]
+    stage3 = [x for t in blocks for x in t]
+    return f'''// record of properties
+static constexpr uint32_t RED_PROP_RECORD[] = {{
+{array(list(records), 8, 6)}
+}};
+// stage 1: [ch >> 9] -> block of stage 2
+static constexpr uint8_t RED_PROP_STAGE1[] = {{
+{array(top, 16, 2)}
+}};
+// stage 2: [block << 5 | (ch >> 4) & 31] -> block of stage 3
+static constexpr uint16_t RED_PROP_STAGE2[] = {{
+{array(stage2, 16, 3)}
+}};
+// stage 3: [block << 4 | ch & 15] -> record
+static constexpr uint8_t RED_PROP_STAGE3[] = {{
+{array(stage3, 16, 2)}
+}};
+'''
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    dump, path = sys.argv[1], sys.argv[2]
+    tables = generate(dump)
+    src = open(path, encoding='utf-8-sig', newline='\n').read()
+    begin = src.index(BEGIN)
+    end = src.index('};\n', src.index('RED_PROP_STAGE3[]')) + 3
+    if '--check' in sys.argv:
+        same = src[begin:end] == tables
+        print('up to date' if same else 'out of date')
+        sys.exit(0 if same else 1)
+    out = src[:begin] + tables + src[end:]
+    open(path, 'w', encoding='utf-8-sig', newline='\n').write(out)
+
+
+if __name__ == '__main__':
+    main()